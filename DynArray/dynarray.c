@@ -1,13 +1,48 @@
 #include "linear_sequence.h"
-#include <mem.h>
+#include "scan_kernels.h"
+#include "sort.h"
+#include "tiered_vector.h"
+#include <string.h>
+
+#ifndef _WIN32
+#define MAPPED_SEQUENCE
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 #define INITIAL_SEQUENCE_SIZE 1
 #define ENLARGE_SEQUENSE_MULTIPLIER 2
 #define REDUSE_SEQUENSE_MULTIPLIER 2
 #define FACTOR_FOR_REDUCTION_SEQUENSE 0.25
 
+/*   ,     */
+static const LSQ_CapacityPolicyT DefaultCapacityPolicy = {
+    ENLARGE_SEQUENSE_MULTIPLIER, REDUSE_SEQUENSE_MULTIPLIER, FACTOR_FOR_REDUCTION_SEQUENSE, INITIAL_SEQUENCE_SIZE
+};
+
+#define MAPPED_SEQUENCE_SIGNATURE "LSQDYNA"
+#define MAPPED_SEQUENCE_VERSION 1
+
+/*  ,    .      */
+typedef struct {
+    char signature[8];
+    int version, elementSize;
+    int physicalSize, logicalSize;
+    int head;
+    char padding[36];
+}   MappedHeaderT, *MappedHeaderPtrT;
+
 typedef struct {
     LSQ_BaseTypeT* data;
     int physicalSize, logicalSize;
+    int head;
+    int reservedSize;
+    LSQ_CapacityPolicyT policy;
+    int file;
+    MappedHeaderPtrT mapping;
+    TieredVectorPtrT tiered;
 }   SequenceT, *SequencePtrT;
 
 typedef struct {
@@ -15,41 +50,320 @@ typedef struct {
     LSQ_IntegerIndexT index;   
 }   IteratorT, *IteratorPtrT;
 
-static void InsertElementInSequence(LSQ_HandleT, LSQ_BaseTypeT, LSQ_IntegerIndexT);
-static void DeleteElementFromSequence(LSQ_HandleT, LSQ_IntegerIndexT);
+static LSQ_IntegerIndexT PhysicalIndex(SequencePtrT, LSQ_IntegerIndexT);
+static int ResizeSequence(SequencePtrT, int);
+#ifdef MAPPED_SEQUENCE
+static size_t GetMappingSize(int);
+static int ResizeMappedSequence(SequencePtrT, int);
+static int RemapSequence(SequencePtrT, int);
+static void RotateBuffer(SequencePtrT);
+static void ReverseElements(LSQ_BaseTypeT*, LSQ_BaseTypeT*);
+static void StoreMappedHeader(SequencePtrT);
+#endif
+static int GetEnlargedSize(SequencePtrT, int);
+static int GetReducedSize(SequencePtrT);
+static LSQ_BaseTypeT* GetSegment(SequencePtrT, LSQ_IntegerIndexT, LSQ_IntegerIndexT*);
+static void SortSequenceRange(SequencePtrT, LSQ_IntegerIndexT, LSQ_IntegerIndexT);
+static void MoveElements(SequencePtrT, LSQ_IntegerIndexT, LSQ_IntegerIndexT, LSQ_IntegerIndexT);
+static void WriteElements(SequencePtrT, LSQ_IntegerIndexT, const LSQ_BaseTypeT*, LSQ_IntegerIndexT);
+static void InsertElementsInSequence(LSQ_HandleT, const LSQ_BaseTypeT*, LSQ_IntegerIndexT, LSQ_IntegerIndexT);
+static void DeleteElementsFromSequence(LSQ_HandleT, LSQ_IntegerIndexT, LSQ_IntegerIndexT);
 static LSQ_IteratorT CreateIterator(LSQ_HandleT, LSQ_IntegerIndexT);
 
-static void InsertElementInSequence(LSQ_HandleT handle, LSQ_BaseTypeT element, LSQ_IntegerIndexT index) {
-    LSQ_BaseTypeT* IndexOfElement;
+/* ,    ( -physicalSize  physicalSize)     */
+static LSQ_IntegerIndexT PhysicalIndex(SequencePtrT pointer, LSQ_IntegerIndexT index) {
+    index += pointer->head;
+    if(index < 0)
+        index += pointer->physicalSize;
+    else if(index >= pointer->physicalSize)
+        index -= pointer->physicalSize;
+    return index;
+}
+
+/* ,   .         . *
+ *                       */
+static int ResizeSequence(SequencePtrT pointer, int newSize) {
+    LSQ_BaseTypeT* data;
+    int oldSize = pointer->physicalSize, headSize;
+    
+    if(pointer->tiered != NULL || newSize < pointer->logicalSize || newSize < 1) 
+        return 0;
+#ifdef MAPPED_SEQUENCE
+    if(pointer->mapping != NULL)
+        return ResizeMappedSequence(pointer, newSize);
+#endif
+    if(pointer->head + pointer->logicalSize > oldSize && newSize <= oldSize) {
+        data = (LSQ_BaseTypeT*)malloc(sizeof(LSQ_BaseTypeT) * newSize);
+        if(data == NULL) 
+            return 0;
+        headSize = oldSize - pointer->head;
+        memcpy(data, pointer->data + pointer->head, sizeof(LSQ_BaseTypeT) * headSize);
+        memcpy(data + headSize, pointer->data, sizeof(LSQ_BaseTypeT) * (pointer->logicalSize - headSize));
+        free(pointer->data);
+        pointer->data = data;
+        pointer->head = 0;
+        pointer->physicalSize = newSize;
+        return 1;
+    }
+    if(pointer->head + pointer->logicalSize <= oldSize && pointer->head + pointer->logicalSize > newSize) {
+        memmove(pointer->data, pointer->data + pointer->head, sizeof(LSQ_BaseTypeT) * pointer->logicalSize);
+        pointer->head = 0;
+    }
+    data = (LSQ_BaseTypeT*)realloc(pointer->data, sizeof(LSQ_BaseTypeT) * newSize);
+    if(data == NULL) 
+        return 0;
+    pointer->data = data;
+    pointer->physicalSize = newSize;
+    if(pointer->head + pointer->logicalSize > oldSize) {
+        headSize = oldSize - pointer->head;
+        memmove(data + newSize - headSize, data + pointer->head, sizeof(LSQ_BaseTypeT) * headSize);
+        pointer->head = newSize - headSize;
+    }
+    return 1;
+}
+
+#ifdef MAPPED_SEQUENCE
+
+static size_t GetMappingSize(int size) {
+    return sizeof(MappedHeaderT) + sizeof(LSQ_BaseTypeT) * (size_t)size;
+}
+
+/* ,   ,   .      *
+ *                                */
+static int ResizeMappedSequence(SequencePtrT pointer, int newSize) {
+    int oldSize = pointer->physicalSize, headSize;
+    
+    if(pointer->head + pointer->logicalSize > oldSize && newSize <= oldSize)
+        RotateBuffer(pointer);
+    else if(pointer->head + pointer->logicalSize <= oldSize && pointer->head + pointer->logicalSize > newSize) {
+        memmove(pointer->data, pointer->data + pointer->head, sizeof(LSQ_BaseTypeT) * pointer->logicalSize);
+        pointer->head = 0;
+    }
+    if(newSize != oldSize && !RemapSequence(pointer, newSize))
+        return 0;
+    if(pointer->head + pointer->logicalSize > oldSize) {
+        headSize = oldSize - pointer->head;
+        memmove(pointer->data + newSize - headSize, pointer->data + pointer->head, sizeof(LSQ_BaseTypeT) * headSize);
+        pointer->head = newSize - headSize;
+    }
+    StoreMappedHeader(pointer);
+    return 1;
+}
+
+/* ,          */
+static int RemapSequence(SequencePtrT pointer, int newSize) {
+    size_t oldBytes = GetMappingSize(pointer->physicalSize), newBytes = GetMappingSize(newSize);
+    void* mapping;
+    
+    if(newBytes > oldBytes && ftruncate(pointer->file, (off_t)newBytes) != 0)
+        return 0;
+    mapping = mmap(NULL, newBytes, PROT_READ | PROT_WRITE, MAP_SHARED, pointer->file, 0);
+    if(mapping == MAP_FAILED) 
+        return 0;
+    munmap(pointer->mapping, oldBytes);
+    if(newBytes < oldBytes)
+        ftruncate(pointer->file, (off_t)newBytes);
+    pointer->mapping = (MappedHeaderPtrT)mapping;
+    pointer->data = (LSQ_BaseTypeT*)(pointer->mapping + 1);
+    pointer->physicalSize = newSize;
+    return 1;
+}
+
+/* ,    ,       */
+static void RotateBuffer(SequencePtrT pointer) {
+    LSQ_BaseTypeT* data = pointer->data;
+    
+    ReverseElements(data, data + pointer->head);
+    ReverseElements(data + pointer->head, data + pointer->physicalSize);
+    ReverseElements(data, data + pointer->physicalSize);
+    pointer->head = 0;
+}
+
+static void ReverseElements(LSQ_BaseTypeT* first, LSQ_BaseTypeT* last) {
+    LSQ_BaseTypeT element;
+    
+    while(first < last - 1) {
+        element = *first;
+        *first++ = *--last;
+        *last = element;
+    }
+}
+
+/* ,       */
+static void StoreMappedHeader(SequencePtrT pointer) {
+    pointer->mapping->physicalSize = pointer->physicalSize;
+    pointer->mapping->logicalSize = pointer->logicalSize;
+    pointer->mapping->head = pointer->head;
+}
+
+#endif
+
+/* ,        index    length  *
+ * ,                                                                 */
+static LSQ_BaseTypeT* GetSegment(SequencePtrT pointer, LSQ_IntegerIndexT index, LSQ_IntegerIndexT* length) {
+    LSQ_IntegerIndexT position;
+    
+    if(pointer->tiered != NULL)
+        return GetTieredSegment(pointer->tiered, index, length);
+    position = PhysicalIndex(pointer, index);
+    *length = pointer->physicalSize - position;
+    if(*length > pointer->logicalSize - index) 
+        *length = pointer->logicalSize - index;
+    return pointer->data + position;
+}
+
+/* ,      begin  end.            *
+ *    ,                     */
+static void SortSequenceRange(SequencePtrT pointer, LSQ_IntegerIndexT begin, LSQ_IntegerIndexT end) {
+    LSQ_BaseTypeT *buffer, *segment;
+    LSQ_IntegerIndexT i, length;
+    
+    if(end - begin < 2)
+        return;
+    if(pointer->tiered == NULL) {
+        if(pointer->head + begin < pointer->physicalSize && pointer->head + end > pointer->physicalSize && 
+           !ResizeSequence(pointer, pointer->physicalSize))
+            return;
+        SortElements(pointer->data + PhysicalIndex(pointer, begin), end - begin);
+        return;
+    }
+    buffer = (LSQ_BaseTypeT*)malloc(sizeof(LSQ_BaseTypeT) * (end - begin));
+    if(buffer == NULL)
+        return;
+    for(i = begin; i < end; i += length) {
+        segment = GetSegment(pointer, i, &length);
+        if(length > end - i) length = end - i;
+        memcpy(buffer + i - begin, segment, sizeof(LSQ_BaseTypeT) * length);
+    }
+    SortElements(buffer, end - begin);
+    for(i = begin; i < end; i += length) {
+        segment = GetSegment(pointer, i, &length);
+        if(length > end - i) length = end - i;
+        memcpy(segment, buffer + i - begin, sizeof(LSQ_BaseTypeT) * length);
+    }
+    free(buffer);
+}
+
+/* ,  ,    size     */
+static int GetEnlargedSize(SequencePtrT pointer, int size) {
+    int newSize = pointer->physicalSize, nextSize;
+    
+    while(newSize < size) {
+        nextSize = (int)(newSize * pointer->policy.enlargeMultiplier);
+        newSize = nextSize > newSize ? nextSize : newSize + 1;
+    }
+    return newSize;
+}
+
+/* ,     .       *
+ * ,                              */
+static int GetReducedSize(SequencePtrT pointer) {
+    int newSize = pointer->physicalSize, nextSize;
+    int minimalSize = pointer->reservedSize > pointer->policy.minimalSize ? pointer->reservedSize : pointer->policy.minimalSize;
+    
+    if(pointer->policy.reductionFactor <= 0)
+        return newSize;
+    while(pointer->logicalSize <= newSize * pointer->policy.reductionFactor) {
+        nextSize = (int)(newSize / pointer->policy.reduceMultiplier);
+        if(nextSize < minimalSize || nextSize >= newSize)
+            break;
+        newSize = nextSize;
+    }
+    return newSize;
+}
+
+/* ,  count     source   destination   *
+ *                                                               */
+static void MoveElements(SequencePtrT pointer, LSQ_IntegerIndexT destination, LSQ_IntegerIndexT source, LSQ_IntegerIndexT count) {
+    LSQ_IntegerIndexT from, to, length;
+    
+    if(destination < source) {
+        while(count > 0) {
+            from = PhysicalIndex(pointer, source);
+            to = PhysicalIndex(pointer, destination);
+            length = count;
+            if(length > pointer->physicalSize - from) length = pointer->physicalSize - from;
+            if(length > pointer->physicalSize - to) length = pointer->physicalSize - to;
+            memmove(pointer->data + to, pointer->data + from, sizeof(LSQ_BaseTypeT) * length);
+            source += length;
+            destination += length;
+            count -= length;
+        }
+    }
+    else {
+        while(count > 0) {
+            from = PhysicalIndex(pointer, source + count - 1);
+            to = PhysicalIndex(pointer, destination + count - 1);
+            length = count;
+            if(length > from + 1) length = from + 1;
+            if(length > to + 1) length = to + 1;
+            memmove(pointer->data + to - length + 1, pointer->data + from - length + 1, sizeof(LSQ_BaseTypeT) * length);
+            count -= length;
+        }
+    }
+}
+
+/* ,  count          index */
+static void WriteElements(SequencePtrT pointer, LSQ_IntegerIndexT index, const LSQ_BaseTypeT* elements, LSQ_IntegerIndexT count) {
+    LSQ_IntegerIndexT to, length;
+    
+    while(count > 0) {
+        to = PhysicalIndex(pointer, index);
+        length = count;
+        if(length > pointer->physicalSize - to) length = pointer->physicalSize - to;
+        memcpy(pointer->data + to, elements, sizeof(LSQ_BaseTypeT) * length);
+        elements += length;
+        index += length;
+        count -= length;
+    }
+}
+
+static void InsertElementsInSequence(LSQ_HandleT handle, const LSQ_BaseTypeT* elements, LSQ_IntegerIndexT index, LSQ_IntegerIndexT count) {
     SequencePtrT pointer = (SequencePtrT)handle;
        
-    if (pointer != NULL) {
-        if(pointer->logicalSize == pointer->physicalSize) {
-            pointer->physicalSize *= ENLARGE_SEQUENSE_MULTIPLIER;  
-            pointer->data = (LSQ_BaseTypeT*)realloc(pointer->data, sizeof(LSQ_BaseTypeT) * pointer->physicalSize);
-        }
-        IndexOfElement = pointer->data + index;
-        memmove(IndexOfElement + 1, IndexOfElement, sizeof(LSQ_BaseTypeT) * (pointer->logicalSize - index)); 
-        *IndexOfElement = element;
-        pointer->logicalSize++;
+    if(pointer == NULL || elements == NULL || count <= 0 || index < 0 || index > pointer->logicalSize) 
+        return;
+    if(pointer->tiered != NULL) {
+        if(InsertTieredElements(pointer->tiered, index, elements, count))
+            pointer->logicalSize += count;
+        return;
+    }
+    if(pointer->logicalSize + count > pointer->physicalSize && 
+       !ResizeSequence(pointer, GetEnlargedSize(pointer, pointer->logicalSize + count)))
+        return;
+    if(index < pointer->logicalSize - index) {
+        MoveElements(pointer, -count, 0, index);
+        pointer->head = PhysicalIndex(pointer, -count);
     }
+    else 
+        MoveElements(pointer, index + count, index, pointer->logicalSize - index);
+    WriteElements(pointer, index, elements, count);
+    pointer->logicalSize += count;
 }
 
-static void DeleteElementFromSequence(LSQ_HandleT handle, LSQ_IntegerIndexT index) {
-    LSQ_BaseTypeT* IndexOfElement;
+static void DeleteElementsFromSequence(LSQ_HandleT handle, LSQ_IntegerIndexT index, LSQ_IntegerIndexT count) {
     SequencePtrT pointer = (SequencePtrT)handle;
+    int newSize;
       
-    if(pointer != NULL) {
-        if(pointer->logicalSize > 0) {
-            IndexOfElement = pointer->data + index;
-            memmove(IndexOfElement , IndexOfElement + 1, sizeof(LSQ_BaseTypeT) * (pointer->logicalSize - index)); 
-            pointer->logicalSize--;
-        }               
-		if(pointer->logicalSize <= pointer->physicalSize * FACTOR_FOR_REDUCTION_SEQUENSE) {
-			pointer->physicalSize /= REDUSE_SEQUENSE_MULTIPLIER;
-			pointer->data = (LSQ_BaseTypeT*)realloc(pointer->data, sizeof(LSQ_BaseTypeT) * pointer->logicalSize);
-		}
-    }      
+    if(pointer == NULL || count <= 0 || index < 0 || index + count > pointer->logicalSize)
+        return;
+    if(pointer->tiered != NULL) {
+        DeleteTieredElements(pointer->tiered, index, count);
+        pointer->logicalSize -= count;
+        return;
+    }
+    if(index < pointer->logicalSize - index - count) {
+        MoveElements(pointer, count, 0, index);
+        pointer->head = PhysicalIndex(pointer, count);
+    }
+    else
+        MoveElements(pointer, index, index + count, pointer->logicalSize - index - count);
+    pointer->logicalSize -= count;
+    if(pointer->logicalSize == 0)
+        pointer->head = 0;
+    newSize = GetReducedSize(pointer);
+    if(newSize != pointer->physicalSize)
+        ResizeSequence(pointer, newSize);
 }
 
 static LSQ_IteratorT CreateIterator(LSQ_HandleT handle, LSQ_IntegerIndexT index) {
@@ -64,22 +378,52 @@ static LSQ_IteratorT CreateIterator(LSQ_HandleT handle, LSQ_IntegerIndexT index)
 
 /* ,   .     */
 extern LSQ_HandleT LSQ_CreateSequence(void) {
+    return LSQ_CreateSequenceWithLayout(LSQ_LAYOUT_FLAT);
+}
+
+/* ,         */
+extern LSQ_HandleT LSQ_CreateSequenceWithLayout(LSQ_SequenceLayoutT layout) {
     SequencePtrT pointer = (SequencePtrT)malloc(sizeof(SequenceT));
     
     if(pointer == LSQ_HandleInvalid)
         return LSQ_HandleInvalid;            
-    pointer->data = (LSQ_BaseTypeT*)malloc(sizeof(LSQ_BaseTypeT) * INITIAL_SEQUENCE_SIZE);
-    pointer->physicalSize = INITIAL_SEQUENCE_SIZE;
+    pointer->data = NULL;
+    pointer->tiered = NULL;
+    if(layout == LSQ_LAYOUT_TIERED)
+        pointer->tiered = CreateTieredVector();
+    else
+        pointer->data = (LSQ_BaseTypeT*)malloc(sizeof(LSQ_BaseTypeT) * INITIAL_SEQUENCE_SIZE);
+    if(pointer->data == NULL && pointer->tiered == NULL) {
+        free(pointer);
+        return LSQ_HandleInvalid;
+    }
+    pointer->physicalSize = pointer->tiered == NULL ? INITIAL_SEQUENCE_SIZE : 0;
     pointer->logicalSize = 0;
+    pointer->head = 0;
+    pointer->reservedSize = 0;
+    pointer->policy = DefaultCapacityPolicy;
+    pointer->file = -1;
+    pointer->mapping = NULL;
     return pointer;
 }
 
 /* ,     .     */
 extern void LSQ_DestroySequence(LSQ_HandleT handle) {    
-    if (handle != LSQ_HandleInvalid) {
-        free(((SequencePtrT)handle)->data);
-        free(handle);
+    SequencePtrT pointer = (SequencePtrT)handle;
+    
+    if (pointer == LSQ_HandleInvalid) 
+        return;
+#ifdef MAPPED_SEQUENCE
+    if(pointer->mapping != NULL) {
+        StoreMappedHeader(pointer);
+        munmap(pointer->mapping, GetMappingSize(pointer->physicalSize));
+        close(pointer->file);
     }
+    else
+#endif
+        free(pointer->data);
+    DestroyTieredVector(pointer->tiered);
+    free(pointer);
 }
 
 /* ,       */
@@ -138,9 +482,11 @@ extern int LSQ_IsIteratorBeforeFirst(LSQ_IteratorT iterator) {
 extern LSQ_BaseTypeT* LSQ_DereferenceIterator(LSQ_IteratorT iterator) {
     IteratorPtrT iter = (IteratorPtrT)iterator;
        
-    if( iter == NULL || ((SequencePtrT)(iter->handle)) == LSQ_HandleInvalid )
+    if( iter == NULL || ((SequencePtrT)(iter->handle)) == LSQ_HandleInvalid || !LSQ_IsIteratorDereferencable(iterator) )
         return NULL;
-    return ((SequencePtrT)(iter->handle))->data + iter->index;
+    if(iter->handle->tiered != NULL)
+        return GetTieredElement(iter->handle->tiered, iter->index);
+    return iter->handle->data + PhysicalIndex(iter->handle, iter->index);
 }
 
 /* ,       */
@@ -170,37 +516,279 @@ extern void LSQ_SetPosition(LSQ_IteratorT iterator, LSQ_IntegerIndexT pos) {
 /* ,      */
 extern void LSQ_InsertFrontElement(LSQ_HandleT handle, LSQ_BaseTypeT element) {
     if(handle != NULL)
-		InsertElementInSequence(handle, element, 0);
+		InsertElementsInSequence(handle, &element, 0, 1);
 }
 
 /* ,      */
 extern void LSQ_InsertRearElement(LSQ_HandleT handle, LSQ_BaseTypeT element) {
     if(handle != NULL)
-		InsertElementInSequence(handle, element, ((SequencePtrT)handle)->logicalSize);
+		InsertElementsInSequence(handle, &element, ((SequencePtrT)handle)->logicalSize, 1);
 }
 
 /* ,      ,     . ,    *
  *  ,    ,      .                                  */
 extern void LSQ_InsertElementBeforeGiven(LSQ_IteratorT iterator, LSQ_BaseTypeT newElement) {
     if(iterator != NULL)
-		InsertElementInSequence(((IteratorPtrT)iterator)->handle, newElement, ((IteratorPtrT)iterator)->index);
+		InsertElementsInSequence(((IteratorPtrT)iterator)->handle, &newElement, ((IteratorPtrT)iterator)->index, 1);
 }
 
 /* ,     */
 extern void LSQ_DeleteFrontElement(LSQ_HandleT handle) {
 	if(handle != NULL)
-		DeleteElementFromSequence(handle, 0);
+		DeleteElementsFromSequence(handle, 0, 1);
 }
 
 /* ,     */
 extern void LSQ_DeleteRearElement(LSQ_HandleT handle) {
 	if(handle != NULL)
-		DeleteElementFromSequence(handle, ((SequencePtrT)handle)->logicalSize - 1);
+		DeleteElementsFromSequence(handle, ((SequencePtrT)handle)->logicalSize - 1, 1);
 }
 
 /* ,   ,   .          *
  *     .                                                                                    */
 extern void LSQ_DeleteGivenElement(LSQ_IteratorT iterator) {
 	if(iterator != NULL)
-		DeleteElementFromSequence(((IteratorPtrT)iterator)->handle, ((IteratorPtrT)iterator)->index);
+		DeleteElementsFromSequence(((IteratorPtrT)iterator)->handle, ((IteratorPtrT)iterator)->index, 1);
+}
+
+/* ,  count   elements    ,    . *
+ *       .                                                              */
+extern void LSQ_InsertRangeBeforeGiven(LSQ_IteratorT iterator, const LSQ_BaseTypeT* elements, LSQ_IntegerIndexT count) {
+    if(iterator != NULL)
+        InsertElementsInSequence(((IteratorPtrT)iterator)->handle, elements, ((IteratorPtrT)iterator)->index, count);
+}
+
+/* ,  count   elements    */
+extern void LSQ_AppendRange(LSQ_HandleT handle, const LSQ_BaseTypeT* elements, LSQ_IntegerIndexT count) {
+    if(handle != NULL)
+        InsertElementsInSequence(handle, elements, ((SequencePtrT)handle)->logicalSize, count);
+}
+
+/* ,     first   last   */
+extern void LSQ_DeleteRange(LSQ_IteratorT first, LSQ_IteratorT last) {
+    IteratorPtrT from = (IteratorPtrT)first, to = (IteratorPtrT)last;
+    LSQ_IntegerIndexT begin, end;
+    
+    if(from == NULL || to == NULL || from->handle != to->handle)
+        return;
+    begin = from->index < 0 ? 0 : from->index;
+    end = to->index > from->handle->logicalSize ? from->handle->logicalSize : to->index;
+    if(begin < end)
+        DeleteElementsFromSequence(from->handle, begin, end - begin);
+}
+
+/* ,     */
+extern LSQ_IntegerIndexT LSQ_GetCapacity(LSQ_HandleT handle) {
+    if(handle == LSQ_HandleInvalid)
+        return -1;
+    if(((SequencePtrT)handle)->tiered != NULL)
+        return GetTieredCapacity(((SequencePtrT)handle)->tiered);
+    return ((SequencePtrT)handle)->physicalSize;
+}
+
+/* ,     capacity .      *
+ *   .                                                                                     */
+extern void LSQ_Reserve(LSQ_HandleT handle, LSQ_IntegerIndexT capacity) {
+    SequencePtrT pointer = (SequencePtrT)handle;
+    
+    if(pointer == NULL || pointer->tiered != NULL || capacity < 0)
+        return;
+    if(capacity > pointer->physicalSize && !ResizeSequence(pointer, capacity))
+        return;
+    pointer->reservedSize = capacity;
+}
+
+/* ,         (   )    */
+extern void LSQ_ShrinkToFit(LSQ_HandleT handle) {
+    SequencePtrT pointer = (SequencePtrT)handle;
+    int newSize;
+    
+    if(pointer == NULL || pointer->tiered != NULL)
+        return;
+    pointer->reservedSize = 0;
+    newSize = pointer->logicalSize > pointer->policy.minimalSize ? pointer->logicalSize : pointer->policy.minimalSize;
+    if(newSize < pointer->physicalSize)
+        ResizeSequence(pointer, newSize);
+}
+
+/* ,     .  0,    */
+extern int LSQ_SetCapacityPolicy(LSQ_HandleT handle, LSQ_CapacityPolicyT policy) {
+    SequencePtrT pointer = (SequencePtrT)handle;
+    
+    if(pointer == NULL || pointer->tiered != NULL || policy.enlargeMultiplier <= 1 || policy.minimalSize < 1 ||
+       (policy.reductionFactor > 0 && (policy.reduceMultiplier <= 1 || policy.reductionFactor * policy.reduceMultiplier >= 1)))
+        return 0;
+    if(pointer->physicalSize < policy.minimalSize && !ResizeSequence(pointer, policy.minimalSize))
+        return 0;
+    pointer->policy = policy;
+    return 1;
+}
+
+/* ,      */
+extern LSQ_CapacityPolicyT LSQ_GetCapacityPolicy(LSQ_HandleT handle) {
+    if(handle == LSQ_HandleInvalid)
+        return DefaultCapacityPolicy;
+    return ((SequencePtrT)handle)->policy;
+}
+
+/* ,    ,  value,  -1,     */
+extern LSQ_IntegerIndexT LSQ_FindValue(LSQ_HandleT handle, LSQ_BaseTypeT value) {
+    SequencePtrT pointer = (SequencePtrT)handle;
+    LSQ_BaseTypeT* segment;
+    LSQ_IntegerIndexT i, length, index;
+    
+    if(pointer == NULL)
+        return -1;
+    for(i = 0; i < pointer->logicalSize; i += length) {
+        segment = GetSegment(pointer, i, &length);
+        index = GetScanKernels()->find(segment, length, value);
+        if(index >= 0)
+            return i + index;
+    }
+    return -1;
+}
+
+/* ,   ,  value */
+extern LSQ_IntegerIndexT LSQ_CountValue(LSQ_HandleT handle, LSQ_BaseTypeT value) {
+    SequencePtrT pointer = (SequencePtrT)handle;
+    LSQ_BaseTypeT* segment;
+    LSQ_IntegerIndexT i, length, result = 0;
+    
+    if(pointer == NULL)
+        return 0;
+    for(i = 0; i < pointer->logicalSize; i += length) {
+        segment = GetSegment(pointer, i, &length);
+        result += GetScanKernels()->count(segment, length, value);
+    }
+    return result;
+}
+
+/* ,      .  0,    */
+extern int LSQ_MinMax(LSQ_HandleT handle, LSQ_BaseTypeT* min, LSQ_BaseTypeT* max) {
+    SequencePtrT pointer = (SequencePtrT)handle;
+    LSQ_BaseTypeT *segment, minimum, maximum;
+    LSQ_IntegerIndexT i, length;
+    
+    if(pointer == NULL || pointer->logicalSize == 0)
+        return 0;
+    minimum = maximum = *GetSegment(pointer, 0, &length);
+    for(i = 0; i < pointer->logicalSize; i += length) {
+        segment = GetSegment(pointer, i, &length);
+        GetScanKernels()->minMax(segment, length, &minimum, &maximum);
+    }
+    if(min != NULL) *min = minimum;
+    if(max != NULL) *max = maximum;
+    return 1;
+}
+
+#ifdef LSQ_SUM_TYPE
+/* ,     */
+extern LSQ_SUM_TYPE LSQ_Sum(LSQ_HandleT handle) {
+    SequencePtrT pointer = (SequencePtrT)handle;
+    LSQ_BaseTypeT* segment;
+    LSQ_IntegerIndexT i, length;
+    LSQ_SUM_TYPE result = 0;
+    
+    if(pointer == NULL)
+        return 0;
+    for(i = 0; i < pointer->logicalSize; i += length) {
+        segment = GetSegment(pointer, i, &length);
+        result += GetScanKernels()->sum(segment, length);
+    }
+    return result;
+}
+#endif
+
+/* ,      */
+extern void LSQ_Sort(LSQ_HandleT handle) {
+    if(handle != NULL)
+        SortSequenceRange((SequencePtrT)handle, 0, ((SequencePtrT)handle)->logicalSize);
+}
+
+/* ,       first   last   */
+extern void LSQ_SortRange(LSQ_IteratorT first, LSQ_IteratorT last) {
+    IteratorPtrT from = (IteratorPtrT)first, to = (IteratorPtrT)last;
+    LSQ_IntegerIndexT begin, end;
+    
+    if(from == NULL || to == NULL || from->handle != to->handle)
+        return;
+    begin = from->index < 0 ? 0 : from->index;
+    end = to->index > from->handle->logicalSize ? from->handle->logicalSize : to->index;
+    SortSequenceRange(from->handle, begin, end);
+}
+
+/* ,  ,    path,      LSQ_MAPPED_CREATE.  *
+ *     ,       .            *
+ * LSQ_MAPPED_TRUNCATE   .                                                      */
+extern LSQ_HandleT LSQ_OpenMappedSequence(const char* path, int flags) {
+#ifdef MAPPED_SEQUENCE
+    SequencePtrT pointer;
+    MappedHeaderT header;
+    struct stat status;
+    void* mapping;
+    int file;
+    
+    if(path == NULL)
+        return LSQ_HandleInvalid;
+    file = open(path, O_RDWR | ((flags & LSQ_MAPPED_CREATE) ? O_CREAT : 0), 0666);
+    if(file < 0)
+        return LSQ_HandleInvalid;
+    if(fstat(file, &status) != 0)
+        goto error;
+    if(status.st_size == 0 || (flags & LSQ_MAPPED_TRUNCATE)) {
+        memset(&header, 0, sizeof(header));
+        memcpy(header.signature, MAPPED_SEQUENCE_SIGNATURE, sizeof(MAPPED_SEQUENCE_SIGNATURE));
+        header.version = MAPPED_SEQUENCE_VERSION;
+        header.elementSize = sizeof(LSQ_BaseTypeT);
+        header.physicalSize = INITIAL_SEQUENCE_SIZE;
+        if(ftruncate(file, 0) != 0 || ftruncate(file, (off_t)GetMappingSize(header.physicalSize)) != 0 ||
+           pwrite(file, &header, sizeof(header), 0) != (ssize_t)sizeof(header))
+            goto error;
+    }
+    else if(pread(file, &header, sizeof(header), 0) != (ssize_t)sizeof(header) ||
+            memcmp(header.signature, MAPPED_SEQUENCE_SIGNATURE, sizeof(MAPPED_SEQUENCE_SIGNATURE)) != 0 ||
+            header.version != MAPPED_SEQUENCE_VERSION || header.elementSize != sizeof(LSQ_BaseTypeT) ||
+            header.physicalSize < 1 || header.logicalSize < 0 || header.logicalSize > header.physicalSize ||
+            header.head < 0 || header.head >= header.physicalSize || 
+            (size_t)status.st_size < GetMappingSize(header.physicalSize))
+        goto error;
+    
+    mapping = mmap(NULL, GetMappingSize(header.physicalSize), PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    if(mapping == MAP_FAILED)
+        goto error;
+    pointer = (SequencePtrT)malloc(sizeof(SequenceT));
+    if(pointer == NULL) {
+        munmap(mapping, GetMappingSize(header.physicalSize));
+        goto error;
+    }
+    pointer->mapping = (MappedHeaderPtrT)mapping;
+    pointer->data = (LSQ_BaseTypeT*)(pointer->mapping + 1);
+    pointer->physicalSize = header.physicalSize;
+    pointer->logicalSize = header.logicalSize;
+    pointer->head = header.head;
+    pointer->reservedSize = 0;
+    pointer->policy = DefaultCapacityPolicy;
+    pointer->file = file;
+    pointer->tiered = NULL;
+    return pointer;
+    
+error:
+    close(file);
+#endif
+    return LSQ_HandleInvalid;
+}
+
+/* ,     ,   .  0   *
+ *                                                                  */
+extern int LSQ_SyncSequence(LSQ_HandleT handle) {
+#ifdef MAPPED_SEQUENCE
+    SequencePtrT pointer = (SequencePtrT)handle;
+    
+    if(pointer == NULL || pointer->mapping == NULL)
+        return 0;
+    StoreMappedHeader(pointer);
+    return msync(pointer->mapping, GetMappingSize(pointer->physicalSize), MS_SYNC) == 0;
+#else
+    return 0;
+#endif
 }
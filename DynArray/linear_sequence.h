@@ -4,8 +4,27 @@
 
 #include <stdlib.h>
 
+/*          LSQ_BASE_TYPE (  int)   *
+ *   .     <  ==    LSQ_BASE_TYPE_LESS             *
+ * LSQ_BASE_TYPE_EQUAL,   LSQ_Sum -   LSQ_SUM_TYPE. LSQ_BASE_TYPE_INT ,   - 32-   *
+ * int,       .                                                 */
+#ifndef LSQ_BASE_TYPE
+#define LSQ_BASE_TYPE int
+#define LSQ_BASE_TYPE_INT
+#define LSQ_SUM_TYPE long long
+#endif
+#ifndef LSQ_BASE_TYPE_LESS
+#define LSQ_BASE_TYPE_LESS(a, b) ((a) < (b))
+#endif
+#ifndef LSQ_BASE_TYPE_EQUAL
+#define LSQ_BASE_TYPE_EQUAL(a, b) ((a) == (b))
+#endif
+#if defined(LSQ_BASE_TYPE_INT) && !defined(LSQ_SUM_TYPE)
+#define LSQ_SUM_TYPE long long
+#endif
+
 /*      */
-typedef int LSQ_BaseTypeT;
+typedef LSQ_BASE_TYPE LSQ_BaseTypeT;
 
 /*   */
 typedef void* LSQ_HandleT;
@@ -19,8 +38,30 @@ typedef void* LSQ_IteratorT;
 /*     */
 typedef int LSQ_IntegerIndexT;
 
+/*    .      enlargeMultiplier;    *
+ *     reductionFactor,    reduceMultiplier (reductionFactor = 0 *
+ *  ).  reductionFactor * reduceMultiplier    ,    *
+ *           .                         */
+typedef struct {
+    double enlargeMultiplier;
+    double reduceMultiplier;
+    double reductionFactor;
+    int minimalSize;
+}   LSQ_CapacityPolicyT;
+
+/*   . LSQ_LAYOUT_FLAT -  :          *
+ *  ,    - O(n). LSQ_LAYOUT_TIERED -        *
+ * :       O(sqrt(n)),    - O(1).          *
+ *     LSQ_LAYOUT_FLAT.                                                 */
+typedef enum {
+    LSQ_LAYOUT_FLAT,
+    LSQ_LAYOUT_TIERED
+}   LSQ_SequenceLayoutT;
+
 /* ,   .     */
 extern LSQ_HandleT LSQ_CreateSequence(void);
+/* ,         */
+extern LSQ_HandleT LSQ_CreateSequenceWithLayout(LSQ_SequenceLayoutT layout);
 /* ,     .     */
 extern void LSQ_DestroySequence(LSQ_HandleT handle);
 
@@ -73,4 +114,56 @@ extern void LSQ_DeleteRearElement(LSQ_HandleT handle);
  *     .                                                                                    */
 extern void LSQ_DeleteGivenElement(LSQ_IteratorT iterator);
 
+/* ,  count   elements    ,    . *
+ *       .                                                              */
+extern void LSQ_InsertRangeBeforeGiven(LSQ_IteratorT iterator, const LSQ_BaseTypeT* elements, LSQ_IntegerIndexT count);
+/* ,  count   elements    */
+extern void LSQ_AppendRange(LSQ_HandleT handle, const LSQ_BaseTypeT* elements, LSQ_IntegerIndexT count);
+/* ,     first   last   */
+extern void LSQ_DeleteRange(LSQ_IteratorT first, LSQ_IteratorT last);
+
+/* ,     */
+extern LSQ_IntegerIndexT LSQ_GetCapacity(LSQ_HandleT handle);
+/* ,     capacity .      *
+ *   .                                                                                     */
+extern void LSQ_Reserve(LSQ_HandleT handle, LSQ_IntegerIndexT capacity);
+/* ,         (   )    */
+extern void LSQ_ShrinkToFit(LSQ_HandleT handle);
+/* ,     .  0,    */
+extern int LSQ_SetCapacityPolicy(LSQ_HandleT handle, LSQ_CapacityPolicyT policy);
+/* ,      */
+extern LSQ_CapacityPolicyT LSQ_GetCapacityPolicy(LSQ_HandleT handle);
+
+/*      ,     */
+/* ,    ,  value,  -1,     */
+extern LSQ_IntegerIndexT LSQ_FindValue(LSQ_HandleT handle, LSQ_BaseTypeT value);
+/* ,   ,  value */
+extern LSQ_IntegerIndexT LSQ_CountValue(LSQ_HandleT handle, LSQ_BaseTypeT value);
+/* ,      .  0,    */
+extern int LSQ_MinMax(LSQ_HandleT handle, LSQ_BaseTypeT* min, LSQ_BaseTypeT* max);
+#ifdef LSQ_SUM_TYPE
+/* ,     */
+extern LSQ_SUM_TYPE LSQ_Sum(LSQ_HandleT handle);
+#endif
+
+/* ,      */
+extern void LSQ_Sort(LSQ_HandleT handle);
+/* ,       first   last   */
+extern void LSQ_SortRange(LSQ_IteratorT first, LSQ_IteratorT last);
+/* ,    ,   ,    *
+ * (0 -   )                                                                      */
+extern void LSQ_SetSortParallelism(LSQ_IntegerIndexT threshold, int threads);
+
+/*   ,    */
+#define LSQ_MAPPED_CREATE 1
+#define LSQ_MAPPED_TRUNCATE 2
+
+/* ,  ,    path,      LSQ_MAPPED_CREATE.  *
+ *     ,       .            *
+ * LSQ_MAPPED_TRUNCATE   .    LSQ_DestroySequence.   */
+extern LSQ_HandleT LSQ_OpenMappedSequence(const char* path, int flags);
+/* ,     ,   .  0   *
+ *                                                                  */
+extern int LSQ_SyncSequence(LSQ_HandleT handle);
+
 #endif
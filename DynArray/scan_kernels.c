@@ -0,0 +1,205 @@
+#include "scan_kernels.h"
+
+#if defined(LSQ_BASE_TYPE_INT) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SCAN_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+static LSQ_IntegerIndexT FindScalar(const LSQ_BaseTypeT*, LSQ_IntegerIndexT, LSQ_BaseTypeT);
+static LSQ_IntegerIndexT CountScalar(const LSQ_BaseTypeT*, LSQ_IntegerIndexT, LSQ_BaseTypeT);
+static void MinMaxScalar(const LSQ_BaseTypeT*, LSQ_IntegerIndexT, LSQ_BaseTypeT*, LSQ_BaseTypeT*);
+#ifdef LSQ_SUM_TYPE
+static LSQ_SUM_TYPE SumScalar(const LSQ_BaseTypeT*, LSQ_IntegerIndexT);
+#endif
+
+static const ScanKernelsT ScalarKernels = { 
+    FindScalar, CountScalar, MinMaxScalar,
+#ifdef LSQ_SUM_TYPE
+    SumScalar
+#endif
+};
+
+static LSQ_IntegerIndexT FindScalar(const LSQ_BaseTypeT* data, LSQ_IntegerIndexT count, LSQ_BaseTypeT value) {
+    LSQ_IntegerIndexT i;
+    
+    for(i = 0; i < count; i++)
+        if(LSQ_BASE_TYPE_EQUAL(data[i], value)) 
+            return i;
+    return -1;
+}
+
+static LSQ_IntegerIndexT CountScalar(const LSQ_BaseTypeT* data, LSQ_IntegerIndexT count, LSQ_BaseTypeT value) {
+    LSQ_IntegerIndexT i, result = 0;
+    
+    for(i = 0; i < count; i++)
+        result += LSQ_BASE_TYPE_EQUAL(data[i], value) ? 1 : 0;
+    return result;
+}
+
+static void MinMaxScalar(const LSQ_BaseTypeT* data, LSQ_IntegerIndexT count, LSQ_BaseTypeT* min, LSQ_BaseTypeT* max) {
+    LSQ_IntegerIndexT i;
+    
+    for(i = 0; i < count; i++) {
+        if(LSQ_BASE_TYPE_LESS(data[i], *min)) *min = data[i];
+        if(LSQ_BASE_TYPE_LESS(*max, data[i])) *max = data[i];
+    }
+}
+
+#ifdef LSQ_SUM_TYPE
+static LSQ_SUM_TYPE SumScalar(const LSQ_BaseTypeT* data, LSQ_IntegerIndexT count) {
+    LSQ_IntegerIndexT i;
+    LSQ_SUM_TYPE result = 0;
+    
+    for(i = 0; i < count; i++)
+        result += data[i];
+    return result;
+}
+#endif
+
+#ifdef SCAN_KERNELS_X86
+
+/*    32- int   4 (SSE4.1)  8 (AVX2)   , *
+ *  -                                                                               */
+
+__attribute__((target("sse4.1")))
+static LSQ_IntegerIndexT FindSse(const LSQ_BaseTypeT* data, LSQ_IntegerIndexT count, LSQ_BaseTypeT value) {
+    __m128i key = _mm_set1_epi32(value);
+    LSQ_IntegerIndexT i, index;
+    int mask;
+    
+    for(i = 0; i + 4 <= count; i += 4) {
+        mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + i)), key)));
+        if(mask != 0) 
+            return i + __builtin_ctz(mask);
+    }
+    index = FindScalar(data + i, count - i, value);
+    return index < 0 ? -1 : i + index;
+}
+
+__attribute__((target("sse4.1")))
+static LSQ_IntegerIndexT CountSse(const LSQ_BaseTypeT* data, LSQ_IntegerIndexT count, LSQ_BaseTypeT value) {
+    __m128i key = _mm_set1_epi32(value), total = _mm_setzero_si128();
+    LSQ_IntegerIndexT i;
+    int lanes[4];
+    
+    for(i = 0; i + 4 <= count; i += 4) 
+        total = _mm_sub_epi32(total, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + i)), key));
+    _mm_storeu_si128((__m128i*)lanes, total);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + CountScalar(data + i, count - i, value);
+}
+
+__attribute__((target("sse4.1")))
+static void MinMaxSse(const LSQ_BaseTypeT* data, LSQ_IntegerIndexT count, LSQ_BaseTypeT* min, LSQ_BaseTypeT* max) {
+    __m128i minimum = _mm_set1_epi32(*min), maximum = _mm_set1_epi32(*max), block;
+    LSQ_IntegerIndexT i;
+    int lanes[4];
+    
+    for(i = 0; i + 4 <= count; i += 4) {
+        block = _mm_loadu_si128((const __m128i*)(data + i));
+        minimum = _mm_min_epi32(minimum, block);
+        maximum = _mm_max_epi32(maximum, block);
+    }
+    _mm_storeu_si128((__m128i*)lanes, minimum);
+    MinMaxScalar(lanes, 4, min, max);
+    _mm_storeu_si128((__m128i*)lanes, maximum);
+    MinMaxScalar(lanes, 4, min, max);
+    MinMaxScalar(data + i, count - i, min, max);
+}
+
+__attribute__((target("sse4.1")))
+static LSQ_SUM_TYPE SumSse(const LSQ_BaseTypeT* data, LSQ_IntegerIndexT count) {
+    __m128i total = _mm_setzero_si128(), block;
+    LSQ_IntegerIndexT i;
+    long long lanes[2];
+    
+    for(i = 0; i + 4 <= count; i += 4) {
+        block = _mm_loadu_si128((const __m128i*)(data + i));
+        total = _mm_add_epi64(total, _mm_cvtepi32_epi64(block));
+        total = _mm_add_epi64(total, _mm_cvtepi32_epi64(_mm_srli_si128(block, 8)));
+    }
+    _mm_storeu_si128((__m128i*)lanes, total);
+    return lanes[0] + lanes[1] + SumScalar(data + i, count - i);
+}
+
+__attribute__((target("avx2")))
+static LSQ_IntegerIndexT FindAvx(const LSQ_BaseTypeT* data, LSQ_IntegerIndexT count, LSQ_BaseTypeT value) {
+    __m256i key = _mm256_set1_epi32(value);
+    LSQ_IntegerIndexT i, index;
+    int mask;
+    
+    for(i = 0; i + 8 <= count; i += 8) {
+        mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + i)), key)));
+        if(mask != 0) 
+            return i + __builtin_ctz(mask);
+    }
+    index = FindScalar(data + i, count - i, value);
+    return index < 0 ? -1 : i + index;
+}
+
+__attribute__((target("avx2")))
+static LSQ_IntegerIndexT CountAvx(const LSQ_BaseTypeT* data, LSQ_IntegerIndexT count, LSQ_BaseTypeT value) {
+    __m256i key = _mm256_set1_epi32(value), total = _mm256_setzero_si256();
+    LSQ_IntegerIndexT i;
+    int lanes[8];
+    
+    for(i = 0; i + 8 <= count; i += 8) 
+        total = _mm256_sub_epi32(total, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + i)), key));
+    _mm256_storeu_si256((__m256i*)lanes, total);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + lanes[4] + lanes[5] + lanes[6] + lanes[7] + 
+           CountScalar(data + i, count - i, value);
+}
+
+__attribute__((target("avx2")))
+static void MinMaxAvx(const LSQ_BaseTypeT* data, LSQ_IntegerIndexT count, LSQ_BaseTypeT* min, LSQ_BaseTypeT* max) {
+    __m256i minimum = _mm256_set1_epi32(*min), maximum = _mm256_set1_epi32(*max), block;
+    LSQ_IntegerIndexT i;
+    int lanes[8];
+    
+    for(i = 0; i + 8 <= count; i += 8) {
+        block = _mm256_loadu_si256((const __m256i*)(data + i));
+        minimum = _mm256_min_epi32(minimum, block);
+        maximum = _mm256_max_epi32(maximum, block);
+    }
+    _mm256_storeu_si256((__m256i*)lanes, minimum);
+    MinMaxScalar(lanes, 8, min, max);
+    _mm256_storeu_si256((__m256i*)lanes, maximum);
+    MinMaxScalar(lanes, 8, min, max);
+    MinMaxScalar(data + i, count - i, min, max);
+}
+
+__attribute__((target("avx2")))
+static LSQ_SUM_TYPE SumAvx(const LSQ_BaseTypeT* data, LSQ_IntegerIndexT count) {
+    __m256i total = _mm256_setzero_si256(), block;
+    LSQ_IntegerIndexT i;
+    long long lanes[4];
+    
+    for(i = 0; i + 8 <= count; i += 8) {
+        block = _mm256_loadu_si256((const __m256i*)(data + i));
+        total = _mm256_add_epi64(total, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(block)));
+        total = _mm256_add_epi64(total, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(block, 1)));
+    }
+    _mm256_storeu_si256((__m256i*)lanes, total);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + SumScalar(data + i, count - i);
+}
+
+static const ScanKernelsT SseKernels = { FindSse, CountSse, MinMaxSse, SumSse };
+static const ScanKernelsT AvxKernels = { FindAvx, CountAvx, MinMaxAvx, SumAvx };
+
+#endif
+
+extern const ScanKernelsT* GetScanKernels(void) {
+    static const ScanKernelsT* kernels = NULL;
+    
+    if(kernels != NULL)
+        return kernels;
+#ifdef SCAN_KERNELS_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2"))
+        kernels = &AvxKernels;
+    else if(__builtin_cpu_supports("sse4.1"))
+        kernels = &SseKernels;
+    else
+#endif
+        kernels = &ScalarKernels;
+    return kernels;
+}
@@ -0,0 +1,19 @@
+#ifndef SCAN_KERNELS_H
+#define SCAN_KERNELS_H
+
+#include "linear_sequence.h"
+
+/*      . minMax    min  max */
+typedef struct {
+    LSQ_IntegerIndexT (*find)(const LSQ_BaseTypeT* data, LSQ_IntegerIndexT count, LSQ_BaseTypeT value);
+    LSQ_IntegerIndexT (*count)(const LSQ_BaseTypeT* data, LSQ_IntegerIndexT count, LSQ_BaseTypeT value);
+    void (*minMax)(const LSQ_BaseTypeT* data, LSQ_IntegerIndexT count, LSQ_BaseTypeT* min, LSQ_BaseTypeT* max);
+#ifdef LSQ_SUM_TYPE
+    LSQ_SUM_TYPE (*sum)(const LSQ_BaseTypeT* data, LSQ_IntegerIndexT count);
+#endif
+}   ScanKernelsT;
+
+/* ,    ,      */
+extern const ScanKernelsT* GetScanKernels(void);
+
+#endif
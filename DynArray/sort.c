@@ -0,0 +1,285 @@
+#include "sort.h"
+#include <limits.h>
+#include <string.h>
+
+#ifndef _WIN32
+#define PARALLEL_SORT
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#define INSERTION_SORT_LIMIT 64
+#define RADIX_BITS 8
+#define RADIX_SIZE (1 << RADIX_BITS)
+#define PARALLEL_SORT_THRESHOLD 1000000
+#define PARALLEL_SORT_MAX_THREADS 64
+
+static LSQ_IntegerIndexT parallelThreshold = PARALLEL_SORT_THRESHOLD;
+static int parallelThreads = 0;
+
+static void InsertionSort(LSQ_BaseTypeT*, LSQ_IntegerIndexT);
+#ifdef LSQ_BASE_TYPE_INT
+static void RadixSort(LSQ_BaseTypeT*, LSQ_BaseTypeT*, LSQ_IntegerIndexT);
+#define SortPart RadixSort
+#else
+static void MergeSort(LSQ_BaseTypeT*, LSQ_BaseTypeT*, LSQ_IntegerIndexT);
+#define SortPart MergeSort
+#endif
+static void MergeRuns(const LSQ_BaseTypeT*, LSQ_IntegerIndexT, const LSQ_BaseTypeT*, LSQ_IntegerIndexT, LSQ_BaseTypeT*);
+static int CompareElements(const void*, const void*);
+
+static void InsertionSort(LSQ_BaseTypeT* data, LSQ_IntegerIndexT count) {
+    LSQ_IntegerIndexT i, j;
+    LSQ_BaseTypeT element;
+    
+    for(i = 1; i < count; i++) {
+        element = data[i];
+        for(j = i; j > 0 && LSQ_BASE_TYPE_LESS(element, data[j - 1]); j--)
+            data[j] = data[j - 1];
+        data[j] = element;
+    }
+}
+
+static int CompareElements(const void* a, const void* b) {
+    const LSQ_BaseTypeT *x = (const LSQ_BaseTypeT*)a, *y = (const LSQ_BaseTypeT*)b;
+    return LSQ_BASE_TYPE_LESS(*y, *x) - LSQ_BASE_TYPE_LESS(*x, *y);
+}
+
+/* ,    .       */
+static void MergeRuns(const LSQ_BaseTypeT* first, LSQ_IntegerIndexT firstSize, const LSQ_BaseTypeT* second, 
+                      LSQ_IntegerIndexT secondSize, LSQ_BaseTypeT* destination) {
+    LSQ_IntegerIndexT i = 0, j = 0;
+    
+    while(i < firstSize && j < secondSize)
+        *destination++ = LSQ_BASE_TYPE_LESS(second[j], first[i]) ? second[j++] : first[i++];
+    memcpy(destination, first + i, sizeof(LSQ_BaseTypeT) * (firstSize - i));
+    memcpy(destination + firstSize - i, second + j, sizeof(LSQ_BaseTypeT) * (secondSize - j));
+}
+
+#ifndef LSQ_BASE_TYPE_INT
+
+/* ,     .     */
+static void MergeSort(LSQ_BaseTypeT* data, LSQ_BaseTypeT* aux, LSQ_IntegerIndexT count) {
+    LSQ_BaseTypeT *source = data, *destination = aux, *swap;
+    LSQ_IntegerIndexT width, low, middle, high;
+    
+    for(low = 0; low < count; low += INSERTION_SORT_LIMIT)
+        InsertionSort(data + low, count - low < INSERTION_SORT_LIMIT ? count - low : INSERTION_SORT_LIMIT);
+    for(width = INSERTION_SORT_LIMIT; width < count; width *= 2) {
+        for(low = 0; low < count; low += 2 * width) {
+            middle = low + width < count ? low + width : count;
+            high = low + 2 * width < count ? low + 2 * width : count;
+            MergeRuns(source + low, middle - low, source + middle, high - middle, destination + low);
+        }
+        swap = source;
+        source = destination;
+        destination = swap;
+    }
+    if(source != data)
+        memcpy(data, source, sizeof(LSQ_BaseTypeT) * count);
+}
+
+#else
+
+/* ,   ,    .   ,  *
+ *    . aux -                                     */
+static void RadixSort(LSQ_BaseTypeT* data, LSQ_BaseTypeT* aux, LSQ_IntegerIndexT count) {
+    LSQ_IntegerIndexT counter[sizeof(LSQ_BaseTypeT)][RADIX_SIZE], offset, size;
+    LSQ_BaseTypeT *source = data, *destination = aux, *swap;
+    unsigned int key, signBit = (unsigned int)INT_MIN;
+    LSQ_IntegerIndexT i;
+    int digit, shift;
+    
+    if(count < INSERTION_SORT_LIMIT) {
+        InsertionSort(data, count);
+        return;
+    }
+    memset(counter, 0, sizeof(counter));
+    for(i = 0; i < count; i++) {
+        key = (unsigned int)data[i] ^ signBit;
+        for(digit = 0; digit < (int)sizeof(LSQ_BaseTypeT); digit++)
+            counter[digit][(key >> (digit * RADIX_BITS)) & (RADIX_SIZE - 1)]++;
+    }
+    for(digit = 0; digit < (int)sizeof(LSQ_BaseTypeT); digit++) {
+        shift = digit * RADIX_BITS;
+        if(counter[digit][(((unsigned int)data[0] ^ signBit) >> shift) & (RADIX_SIZE - 1)] == count)
+            continue;
+        for(i = 0, offset = 0; i < RADIX_SIZE; i++) {
+            size = counter[digit][i];
+            counter[digit][i] = offset;
+            offset += size;
+        }
+        for(i = 0; i < count; i++) {
+            key = (unsigned int)source[i] ^ signBit;
+            destination[counter[digit][(key >> shift) & (RADIX_SIZE - 1)]++] = source[i];
+        }
+        swap = source;
+        source = destination;
+        destination = swap;
+    }
+    if(source != data)
+        memcpy(data, source, sizeof(LSQ_BaseTypeT) * count);
+}
+
+#endif
+
+#ifdef PARALLEL_SORT
+
+typedef struct {
+    const LSQ_BaseTypeT *first, *second;
+    LSQ_IntegerIndexT firstSize, secondSize;
+    LSQ_IntegerIndexT begin, end;
+    LSQ_BaseTypeT *data, *aux;
+    pthread_t thread;
+}   SortTaskT, *SortTaskPtrT;
+
+static void* SortTask(void*);
+static void* MergeTask(void*);
+static LSQ_IntegerIndexT SplitMerge(const SortTaskPtrT, LSQ_IntegerIndexT);
+static int GetThreadCount(LSQ_IntegerIndexT);
+static void RunTasks(SortTaskPtrT, int, void* (*)(void*));
+static void ParallelSort(LSQ_BaseTypeT*, LSQ_BaseTypeT*, LSQ_IntegerIndexT, int);
+
+static void* SortTask(void* argument) {
+    SortTaskPtrT task = (SortTaskPtrT)argument;
+    SortPart(task->data + task->begin, task->aux + task->begin, task->end - task->begin);
+    return NULL;
+}
+
+/* ,        index   */
+static LSQ_IntegerIndexT SplitMerge(const SortTaskPtrT task, LSQ_IntegerIndexT index) {
+    LSQ_IntegerIndexT low = index > task->secondSize ? index - task->secondSize : 0;
+    LSQ_IntegerIndexT high = index < task->firstSize ? index : task->firstSize, middle;
+    
+    while(low < high) {
+        middle = low + (high - low) / 2;
+        if(!LSQ_BASE_TYPE_LESS(task->second[index - middle - 1], task->first[middle]))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+/* ,   data   first  second    begin  end */
+static void* MergeTask(void* argument) {
+    SortTaskPtrT task = (SortTaskPtrT)argument;
+    LSQ_IntegerIndexT i = SplitMerge(task, task->begin), j = task->begin - i;
+    LSQ_IntegerIndexT iEnd = SplitMerge(task, task->end), jEnd = task->end - iEnd;
+    
+    MergeRuns(task->first + i, iEnd - i, task->second + j, jEnd - j, task->data + task->begin);
+    return NULL;
+}
+
+static int GetThreadCount(LSQ_IntegerIndexT count) {
+    long threads = parallelThreads;
+    
+    if(threads <= 0)
+        threads = sysconf(_SC_NPROCESSORS_ONLN);
+    if(threads > PARALLEL_SORT_MAX_THREADS)
+        threads = PARALLEL_SORT_MAX_THREADS;
+    if(threads > count / INSERTION_SORT_LIMIT)
+        threads = count / INSERTION_SORT_LIMIT;
+    return threads < 1 ? 1 : (int)threads;
+}
+
+/* ,     . ,      ,  *
+ *                                                                                           */
+static void RunTasks(SortTaskPtrT tasks, int count, void* (*function)(void*)) {
+    int i, *started = (int*)calloc(count, sizeof(int));
+    
+    for(i = 1; i < count; i++)
+        if(started != NULL)
+            started[i] = pthread_create(&tasks[i].thread, NULL, function, &tasks[i]) == 0;
+    function(&tasks[0]);
+    for(i = 1; i < count; i++) {
+        if(started != NULL && started[i])
+            pthread_join(tasks[i].thread, NULL);
+        else
+            function(&tasks[i]);
+    }
+    free(started);
+}
+
+/* ,      threads ,      . *
+ *       ,               */
+static void ParallelSort(LSQ_BaseTypeT* data, LSQ_BaseTypeT* aux, LSQ_IntegerIndexT count, int threads) {
+    LSQ_IntegerIndexT bound[PARALLEL_SORT_MAX_THREADS + 1], size;
+    SortTaskT tasks[PARALLEL_SORT_MAX_THREADS * 2];
+    LSQ_BaseTypeT *source = data, *destination = aux, *swap;
+    int i, j, runs = threads, pairs, pieces, taskCount;
+    
+    for(i = 0; i <= threads; i++)
+        bound[i] = (LSQ_IntegerIndexT)((long long)count * i / threads);
+    for(i = 0; i < threads; i++) {
+        tasks[i].data = data;
+        tasks[i].aux = aux;
+        tasks[i].begin = bound[i];
+        tasks[i].end = bound[i + 1];
+    }
+    RunTasks(tasks, threads, SortTask);
+    
+    while(runs > 1) {
+        pairs = runs / 2;
+        pieces = threads / pairs > 1 ? threads / pairs : 1;
+        taskCount = 0;
+        for(i = 0; i < pairs; i++) {
+            size = bound[2 * i + 2] - bound[2 * i];
+            for(j = 0; j < pieces; j++) {
+                tasks[taskCount].first = source + bound[2 * i];
+                tasks[taskCount].firstSize = bound[2 * i + 1] - bound[2 * i];
+                tasks[taskCount].second = source + bound[2 * i + 1];
+                tasks[taskCount].secondSize = bound[2 * i + 2] - bound[2 * i + 1];
+                tasks[taskCount].data = destination + bound[2 * i];
+                tasks[taskCount].begin = (LSQ_IntegerIndexT)((long long)size * j / pieces);
+                tasks[taskCount].end = (LSQ_IntegerIndexT)((long long)size * (j + 1) / pieces);
+                taskCount++;
+            }
+        }
+        if(runs % 2 != 0)
+            memcpy(destination + bound[runs - 1], source + bound[runs - 1], sizeof(LSQ_BaseTypeT) * (bound[runs] - bound[runs - 1]));
+        RunTasks(tasks, taskCount, MergeTask);
+        for(i = 0; i < pairs; i++)
+            bound[i + 1] = bound[2 * i + 2];
+        if(runs % 2 != 0)
+            bound[pairs + 1] = bound[runs];
+        runs = pairs + runs % 2;
+        swap = source;
+        source = destination;
+        destination = swap;
+    }
+    if(source != data)
+        memcpy(data, source, sizeof(LSQ_BaseTypeT) * count);
+}
+
+#endif
+
+extern void SortElements(LSQ_BaseTypeT* data, LSQ_IntegerIndexT count) {
+    LSQ_BaseTypeT* aux;
+    
+    if(data == NULL || count < 2)
+        return;
+    if(count < INSERTION_SORT_LIMIT) {
+        InsertionSort(data, count);
+        return;
+    }
+    aux = (LSQ_BaseTypeT*)malloc(sizeof(LSQ_BaseTypeT) * count);
+    if(aux == NULL) {
+        qsort(data, count, sizeof(LSQ_BaseTypeT), CompareElements);
+        return;
+    }
+#ifdef PARALLEL_SORT
+    if(count >= parallelThreshold && GetThreadCount(count) > 1)
+        ParallelSort(data, aux, count, GetThreadCount(count));
+    else
+#endif
+        SortPart(data, aux, count);
+    free(aux);
+}
+
+/* ,    ,   ,    *
+ * (0 -   )                                                                      */
+extern void LSQ_SetSortParallelism(LSQ_IntegerIndexT threshold, int threads) {
+    parallelThreshold = threshold > 0 ? threshold : PARALLEL_SORT_THRESHOLD;
+    parallelThreads = threads > 0 ? threads : 0;
+}
@@ -0,0 +1,10 @@
+#ifndef SORT_H
+#define SORT_H
+
+#include "linear_sequence.h"
+
+/* ,      .    ,  *
+ * LSQ_SetSortParallelism,                                               */
+extern void SortElements(LSQ_BaseTypeT* data, LSQ_IntegerIndexT count);
+
+#endif
@@ -0,0 +1,233 @@
+#include "tiered_vector.h"
+#include <string.h>
+
+#define MINIMAL_BLOCK_SHIFT 6
+#define INITIAL_INDEX_SIZE 4
+
+struct TieredVector {
+    LSQ_BaseTypeT** block;
+    int* head;
+    int blockCount, indexSize;
+    int blockShift;
+    LSQ_IntegerIndexT size;
+};
+
+static int ChooseBlockShift(LSQ_IntegerIndexT);
+static int AppendBlock(TieredVectorPtrT);
+static int Rebuild(TieredVectorPtrT, LSQ_IntegerIndexT, const LSQ_BaseTypeT*, LSQ_IntegerIndexT, LSQ_IntegerIndexT);
+static void InsertElement(TieredVectorPtrT, LSQ_IntegerIndexT, LSQ_BaseTypeT);
+static void DeleteElement(TieredVectorPtrT, LSQ_IntegerIndexT);
+static void FreeBlocks(LSQ_BaseTypeT**, int);
+
+/* ,     B,   2 * B * B   size */
+static int ChooseBlockShift(LSQ_IntegerIndexT size) {
+    int shift = MINIMAL_BLOCK_SHIFT;
+    
+    while(2.0 * (1 << shift) * (1 << shift) < size)
+        shift++;
+    return shift;
+}
+
+/* ,       */
+static int AppendBlock(TieredVectorPtrT vector) {
+    LSQ_BaseTypeT** block;
+    int* head, size;
+    
+    if(vector->blockCount == vector->indexSize) {
+        size = vector->indexSize * 2;
+        block = (LSQ_BaseTypeT**)realloc(vector->block, sizeof(LSQ_BaseTypeT*) * size);
+        if(block == NULL) 
+            return 0;
+        vector->block = block;
+        head = (int*)realloc(vector->head, sizeof(int) * size);
+        if(head == NULL) 
+            return 0;
+        vector->head = head;
+        vector->indexSize = size;
+    }
+    vector->block[vector->blockCount] = (LSQ_BaseTypeT*)malloc(sizeof(LSQ_BaseTypeT) << vector->blockShift);
+    if(vector->block[vector->blockCount] == NULL)
+        return 0;
+    vector->head[vector->blockCount++] = 0;
+    return 1;
+}
+
+static void FreeBlocks(LSQ_BaseTypeT** block, int count) {
+    int i;
+    
+    for(i = 0; i < count; i++)
+        free(block[i]);
+    free(block);
+}
+
+/* ,      ,     . *
+ *      index  , count   elements    *
+ *  ,   index + deleteCount                                                          */
+static int Rebuild(TieredVectorPtrT vector, LSQ_IntegerIndexT index, const LSQ_BaseTypeT* elements, LSQ_IntegerIndexT count,
+                   LSQ_IntegerIndexT deleteCount) {
+    LSQ_IntegerIndexT size = vector->size + count - deleteCount, i, source;
+    int shift = ChooseBlockShift(size), blockCount = (int)((size + (1 << shift) - 1) >> shift);
+    int indexSize = blockCount > INITIAL_INDEX_SIZE ? blockCount : INITIAL_INDEX_SIZE;
+    int mask = (1 << shift) - 1;
+    LSQ_BaseTypeT** block = (LSQ_BaseTypeT**)malloc(sizeof(LSQ_BaseTypeT*) * indexSize);
+    int* head = (int*)calloc(indexSize, sizeof(int));
+    
+    if(block == NULL || head == NULL) {
+        free(block);
+        free(head);
+        return 0;
+    }
+    for(i = 0; i < blockCount; i++) {
+        block[i] = (LSQ_BaseTypeT*)malloc(sizeof(LSQ_BaseTypeT) << shift);
+        if(block[i] == NULL) {
+            FreeBlocks(block, (int)i);
+            free(head);
+            return 0;
+        }
+    }
+    for(i = 0; i < size; i++) {
+        if(i < index)
+            source = i;
+        else if(i < index + count) {
+            block[i >> shift][i & mask] = elements[i - index];
+            continue;
+        }
+        else
+            source = i - count + deleteCount;
+        block[i >> shift][i & mask] = *GetTieredElement(vector, source);
+    }
+    FreeBlocks(vector->block, vector->blockCount);
+    free(vector->head);
+    vector->block = block;
+    vector->head = head;
+    vector->blockCount = blockCount;
+    vector->indexSize = indexSize;
+    vector->blockShift = shift;
+    vector->size = size;
+    return 1;
+}
+
+/* ,  .            *
+ *  ,                                 */
+static void InsertElement(TieredVectorPtrT vector, LSQ_IntegerIndexT index, LSQ_BaseTypeT element) {
+    int mask = (1 << vector->blockShift) - 1, blockIndex = (int)(index >> vector->blockShift), j;
+    int position = (int)(index & mask), count, i;
+    LSQ_BaseTypeT* block;
+    
+    for(j = vector->blockCount - 1; j > blockIndex; j--) {
+        vector->head[j] = (vector->head[j] - 1) & mask;
+        vector->block[j][vector->head[j]] = vector->block[j - 1][(vector->head[j - 1] + mask) & mask];
+    }
+    block = vector->block[blockIndex];
+    count = blockIndex < vector->blockCount - 1 ? mask : (int)(vector->size - ((LSQ_IntegerIndexT)blockIndex << vector->blockShift));
+    if(position < count - position) {
+        vector->head[blockIndex] = (vector->head[blockIndex] - 1) & mask;
+        for(i = 0; i < position; i++)
+            block[(vector->head[blockIndex] + i) & mask] = block[(vector->head[blockIndex] + i + 1) & mask];
+    }
+    else
+        for(i = count; i > position; i--)
+            block[(vector->head[blockIndex] + i) & mask] = block[(vector->head[blockIndex] + i - 1) & mask];
+    block[(vector->head[blockIndex] + position) & mask] = element;
+    vector->size++;
+}
+
+/* ,  .          */
+static void DeleteElement(TieredVectorPtrT vector, LSQ_IntegerIndexT index) {
+    int mask = (1 << vector->blockShift) - 1, blockIndex = (int)(index >> vector->blockShift), j;
+    int position = (int)(index & mask), count, i;
+    LSQ_BaseTypeT* block = vector->block[blockIndex];
+    
+    count = blockIndex < vector->blockCount - 1 ? mask + 1 : (int)(vector->size - ((LSQ_IntegerIndexT)blockIndex << vector->blockShift));
+    if(position < count - position - 1) {
+        for(i = position; i > 0; i--)
+            block[(vector->head[blockIndex] + i) & mask] = block[(vector->head[blockIndex] + i - 1) & mask];
+        vector->head[blockIndex] = (vector->head[blockIndex] + 1) & mask;
+    }
+    else
+        for(i = position; i < count - 1; i++)
+            block[(vector->head[blockIndex] + i) & mask] = block[(vector->head[blockIndex] + i + 1) & mask];
+    for(j = blockIndex + 1; j < vector->blockCount; j++) {
+        vector->block[j - 1][(vector->head[j - 1] + mask) & mask] = vector->block[j][vector->head[j]];
+        vector->head[j] = (vector->head[j] + 1) & mask;
+    }
+    vector->size--;
+    if(((LSQ_IntegerIndexT)(vector->blockCount - 1) << vector->blockShift) == vector->size)
+        free(vector->block[--vector->blockCount]);
+}
+
+extern TieredVectorPtrT CreateTieredVector(void) {
+    TieredVectorPtrT vector = (TieredVectorPtrT)malloc(sizeof(TieredVectorT));
+    
+    if(vector == NULL)
+        return NULL;
+    vector->block = (LSQ_BaseTypeT**)malloc(sizeof(LSQ_BaseTypeT*) * INITIAL_INDEX_SIZE);
+    vector->head = (int*)malloc(sizeof(int) * INITIAL_INDEX_SIZE);
+    if(vector->block == NULL || vector->head == NULL) {
+        free(vector->block);
+        free(vector->head);
+        free(vector);
+        return NULL;
+    }
+    vector->blockCount = 0;
+    vector->indexSize = INITIAL_INDEX_SIZE;
+    vector->blockShift = MINIMAL_BLOCK_SHIFT;
+    vector->size = 0;
+    return vector;
+}
+
+extern void DestroyTieredVector(TieredVectorPtrT vector) {
+    if(vector == NULL)
+        return;
+    FreeBlocks(vector->block, vector->blockCount);
+    free(vector->head);
+    free(vector);
+}
+
+extern LSQ_BaseTypeT* GetTieredElement(TieredVectorPtrT vector, LSQ_IntegerIndexT index) {
+    int mask = (1 << vector->blockShift) - 1, blockIndex = (int)(index >> vector->blockShift);
+    return vector->block[blockIndex] + ((vector->head[blockIndex] + (int)(index & mask)) & mask);
+}
+
+extern LSQ_BaseTypeT* GetTieredSegment(TieredVectorPtrT vector, LSQ_IntegerIndexT index, LSQ_IntegerIndexT* length) {
+    int mask = (1 << vector->blockShift) - 1, blockIndex = (int)(index >> vector->blockShift);
+    int position = (vector->head[blockIndex] + (int)(index & mask)) & mask;
+    LSQ_IntegerIndexT blockRest = (mask + 1) - (index & mask), sizeRest = vector->size - index;
+    
+    *length = mask + 1 - position;
+    if(*length > blockRest) *length = blockRest;
+    if(*length > sizeRest) *length = sizeRest;
+    return vector->block[blockIndex] + position;
+}
+
+extern LSQ_IntegerIndexT GetTieredCapacity(TieredVectorPtrT vector) {
+    return (LSQ_IntegerIndexT)vector->blockCount << vector->blockShift;
+}
+
+/*       ,     */
+extern int InsertTieredElements(TieredVectorPtrT vector, LSQ_IntegerIndexT index, const LSQ_BaseTypeT* elements, LSQ_IntegerIndexT count) {
+    LSQ_IntegerIndexT i;
+    
+    if(count > (1 << vector->blockShift) || 2.0 * (1 << vector->blockShift) * (1 << vector->blockShift) < vector->size + count)
+        return Rebuild(vector, index, elements, count, 0);
+    for(i = 0; i < count; i++) {
+        if(((LSQ_IntegerIndexT)vector->blockCount << vector->blockShift) == vector->size && !AppendBlock(vector)) {
+            while(i-- > 0)
+                DeleteElement(vector, index);
+            return 0;
+        }
+        InsertElement(vector, index + i, elements[i]);
+    }
+    return 1;
+}
+
+extern void DeleteTieredElements(TieredVectorPtrT vector, LSQ_IntegerIndexT index, LSQ_IntegerIndexT count) {
+    LSQ_IntegerIndexT i, blockSize = 1 << vector->blockShift;
+    
+    if(count > blockSize || (vector->blockShift > MINIMAL_BLOCK_SHIFT && (vector->size - count) * 8.0 < (double)blockSize * blockSize)) {
+        if(Rebuild(vector, index, NULL, 0, count))
+            return;
+    }
+    for(i = 0; i < count; i++)
+        DeleteElement(vector, index);
+}
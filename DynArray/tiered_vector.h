@@ -0,0 +1,30 @@
+#ifndef TIERED_VECTOR_H
+#define TIERED_VECTOR_H
+
+#include "linear_sequence.h"
+
+/*  :     B,    -  .  , *
+ *  , .    - O(1),      - O(n / B + B),  *
+ *       .                                                     */
+typedef struct TieredVector TieredVectorT, *TieredVectorPtrT;
+
+/* ,     */
+extern TieredVectorPtrT CreateTieredVector(void);
+/* ,    */
+extern void DestroyTieredVector(TieredVectorPtrT vector);
+
+/* ,        */
+extern LSQ_BaseTypeT* GetTieredElement(TieredVectorPtrT vector, LSQ_IntegerIndexT index);
+/* ,           length  , *
+ *                                                                           */
+extern LSQ_BaseTypeT* GetTieredSegment(TieredVectorPtrT vector, LSQ_IntegerIndexT index, LSQ_IntegerIndexT* length);
+/* ,   ,       */
+extern LSQ_IntegerIndexT GetTieredCapacity(TieredVectorPtrT vector);
+
+/* ,  count      index.  0   , *
+ *                                                                             */
+extern int InsertTieredElements(TieredVectorPtrT vector, LSQ_IntegerIndexT index, const LSQ_BaseTypeT* elements, LSQ_IntegerIndexT count);
+/* ,  count     index */
+extern void DeleteTieredElements(TieredVectorPtrT vector, LSQ_IntegerIndexT index, LSQ_IntegerIndexT count);
+
+#endif
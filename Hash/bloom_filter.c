@@ -0,0 +1,89 @@
+/* posix_memalign   stdlib.h     POSIX */
+#define _POSIX_C_SOURCE 200112L
+#include "bloom_filter.h"
+
+#define CACHE_LINE_SIZE 64
+#define BLOCK_BITS (CACHE_LINE_SIZE * 8)
+#define WORD_BITS 64
+#define BLOCK_WORDS (BLOCK_BITS / WORD_BITS)
+#define MINIMAL_CAPACITY 64
+#define MAXIMAL_HASH_COUNT 16
+/*     log2(1 / p) / ln 2,    - ln 2   .   - *
+ *                                     */
+#define BITS_PER_LOG2 1.44
+#define BLOCK_OVERHEAD 1.1
+#define LN2 0.693
+#define POSITION_MULTIPLIER 0x9e3779b97f4a7c15ull
+
+struct BloomFilter {
+    unsigned long long* word;
+    size_t blockCount, capacity, addedCount;
+    int hashCount;
+};
+
+static unsigned long long* GetBlock(BloomFilterPtrT filter, unsigned long long hash);
+
+/*     ,    -       *
+ *                                                                             */
+static unsigned long long* GetBlock(BloomFilterPtrT filter, unsigned long long hash) {
+    return filter->word + (size_t)(((hash >> 32) * filter->blockCount) >> 32) * BLOCK_WORDS;
+}
+
+extern BloomFilterPtrT CreateBloomFilter(size_t capacity, double falsePositiveRate) {
+    BloomFilterPtrT filter = (BloomFilterPtrT)malloc(sizeof(BloomFilterT));
+    double bitsPerKey = 0.0;
+    size_t i;
+    
+    if(filter == NULL) return NULL;
+    if(capacity < MINIMAL_CAPACITY) capacity = MINIMAL_CAPACITY;
+    for(; falsePositiveRate < 1.0 && bitsPerKey < WORD_BITS; falsePositiveRate *= 2.0)
+        bitsPerKey += BITS_PER_LOG2 * BLOCK_OVERHEAD;
+    if(bitsPerKey == 0.0) bitsPerKey = BITS_PER_LOG2 * BLOCK_OVERHEAD;
+    filter->hashCount = (int)(bitsPerKey * LN2 + 0.5);
+    if(filter->hashCount < 1) filter->hashCount = 1;
+    if(filter->hashCount > MAXIMAL_HASH_COUNT) filter->hashCount = MAXIMAL_HASH_COUNT;
+    filter->blockCount = (size_t)(capacity * bitsPerKey) / BLOCK_BITS + 1;
+    filter->capacity = capacity;
+    filter->addedCount = 0;
+    if(posix_memalign((void**)&filter->word, CACHE_LINE_SIZE, filter->blockCount * CACHE_LINE_SIZE) != 0) {
+        free(filter);
+        return NULL;
+    }
+    for(i = 0; i < filter->blockCount * BLOCK_WORDS; i++)
+        filter->word[i] = 0;
+    return filter;
+}
+
+extern void DestroyBloomFilter(BloomFilterPtrT filter) {
+    if(filter == NULL) return;
+    free(filter->word);
+    free(filter);
+}
+
+extern void AddBloomFilterHash(BloomFilterPtrT filter, unsigned long long hash) {
+    unsigned long long* block = GetBlock(filter, hash);
+    unsigned int position = (unsigned int)hash, step = (unsigned int)((hash * POSITION_MULTIPLIER) >> 32) | 1;
+    int i;
+    
+    for(i = 0; i < filter->hashCount; i++, position += step)
+        block[(position % BLOCK_BITS) / WORD_BITS] |= 1ull << (position % WORD_BITS);
+    filter->addedCount++;
+}
+
+extern int TestBloomFilterHash(BloomFilterPtrT filter, unsigned long long hash) {
+    unsigned long long* block = GetBlock(filter, hash);
+    unsigned int position = (unsigned int)hash, step = (unsigned int)((hash * POSITION_MULTIPLIER) >> 32) | 1;
+    int i;
+    
+    for(i = 0; i < filter->hashCount; i++, position += step)
+        if(!(block[(position % BLOCK_BITS) / WORD_BITS] & (1ull << (position % WORD_BITS)))) return 0;
+    return 1;
+}
+
+extern void PrefetchBloomFilterHash(BloomFilterPtrT filter, unsigned long long hash) {
+    __builtin_prefetch(GetBlock(filter, hash));
+}
+
+extern int IsBloomFilterOverloaded(BloomFilterPtrT filter) {
+    return filter->addedCount > filter->capacity;
+}
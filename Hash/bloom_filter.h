@@ -0,0 +1,25 @@
+#ifndef BLOOM_FILTER_H
+#define BLOOM_FILTER_H
+
+#include <stdlib.h>
+
+/*      64-  .       ,    *
+ *      ,      .   :  *
+ *   capacity ,         .          */
+typedef struct BloomFilter BloomFilterT, *BloomFilterPtrT;
+
+/* ,     capacity      falsePositiveRate. *
+ *  NULL                                                                   */
+extern BloomFilterPtrT CreateBloomFilter(size_t capacity, double falsePositiveRate);
+extern void DestroyBloomFilter(BloomFilterPtrT filter);
+
+/* ,        */
+extern void AddBloomFilterHash(BloomFilterPtrT filter, unsigned long long hash);
+/* ,  0,        ,  1,  , ,  */
+extern int TestBloomFilterHash(BloomFilterPtrT filter, unsigned long long hash);
+/* ,          */
+extern void PrefetchBloomFilterHash(BloomFilterPtrT filter, unsigned long long hash);
+/* , ,    ,     */
+extern int IsBloomFilterOverloaded(BloomFilterPtrT filter);
+
+#endif
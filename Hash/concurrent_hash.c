@@ -0,0 +1,427 @@
+#include "concurrent_hash.h"
+#include "key_hash.h"
+#include <pthread.h>
+#include <stdatomic.h>
+
+/*      STRIPE_COUNT .   -   ,    *
+ *   -       ,   STRIPE_COUNT,    *
+ *    .     :       *
+ *   ,     ,           *
+ *          .                                                 *
+ *       :             *
+ *  ,   ,       ,  ,   *
+ *    e,    e + 2,         .    *
+ *        .                                                 */
+#define CACHE_LINE_SIZE 64
+#define STRIPE_BITS 6
+#define STRIPE_COUNT (1 << STRIPE_BITS)
+#define INITIAL_TABLE_SIZE STRIPE_COUNT
+#define MAXIMAL_LOAD_FACTOR 1
+#define MINIMAL_LOAD_FACTOR 8
+#define EPOCH_SLOT_COUNT 128
+#define RECLAIM_THRESHOLD 64
+/*     .          ,   */
+#define FREE_KEY 1
+#define FREE_VALUE 2
+
+typedef struct ConcurrentPair {
+    LSQ_KeyT key;
+    LSQ_BaseTypeT value;
+    unsigned long long hash;
+    _Atomic(struct ConcurrentPair*) next;
+    struct ConcurrentPair* nextRetired;
+    unsigned long retireEpoch;
+    int freeMask;
+}   ConcurrentPairT, *ConcurrentPairPtrT;
+
+typedef struct BucketArray {
+    size_t count;
+    struct BucketArray* nextRetired;
+    unsigned long retireEpoch;
+    _Atomic(ConcurrentPairPtrT) bucket[];
+}   BucketArrayT, *BucketArrayPtrT;
+
+/*  0   ,       */
+typedef struct {
+    _Alignas(CACHE_LINE_SIZE) atomic_ulong epoch;
+    atomic_int busy;
+    ConcurrentPairPtrT retiredPair;
+    BucketArrayPtrT retiredArray;
+    int retiredCount;
+}   EpochSlotT, *EpochSlotPtrT;
+
+typedef struct {
+    _Alignas(CACHE_LINE_SIZE) pthread_mutex_t mutex;
+}   StripeT;
+
+typedef struct {
+    _Alignas(CACHE_LINE_SIZE) _Atomic(BucketArrayPtrT) buckets;
+    _Alignas(CACHE_LINE_SIZE) atomic_long size;
+    _Alignas(CACHE_LINE_SIZE) atomic_ulong epoch;
+    StripeT* stripes;
+    EpochSlotPtrT slots;
+    
+    LSQ_Callback_CloneFuncT *kcloneFunction;
+    LSQ_Callback_SizeFuncT *ksizeFunction;
+    LSQ_Callback_CompareFuncT *kcompareFunction;
+    LSQ_Callback_CloneFuncT *vcloneFunction;
+    unsigned long long seed;
+}   ConcurrentHashT, *ConcurrentHashPtrT;
+
+/*  ,       . 0 -     */
+static _Thread_local unsigned int threadNumber;
+static atomic_uint nextThreadNumber = 1;
+
+static EpochSlotPtrT EnterEpoch(ConcurrentHashPtrT);
+static void LeaveEpoch(EpochSlotPtrT);
+static void RetirePair(ConcurrentHashPtrT, EpochSlotPtrT, ConcurrentPairPtrT, int);
+static void RetireArray(ConcurrentHashPtrT, EpochSlotPtrT, BucketArrayPtrT);
+static void Reclaim(ConcurrentHashPtrT, EpochSlotPtrT);
+static void FreePair(ConcurrentPairPtrT, int);
+static BucketArrayPtrT CreateBucketArray(size_t);
+static void FreeBucketArray(BucketArrayPtrT, int);
+static size_t GetBucketIndex(unsigned long long, size_t);
+static size_t GetStripeIndex(unsigned long long);
+static _Atomic(ConcurrentPairPtrT)* FindLink(ConcurrentHashPtrT, BucketArrayPtrT, LSQ_KeyT, unsigned long long);
+static ConcurrentPairPtrT FindPair(ConcurrentHashPtrT, BucketArrayPtrT, LSQ_KeyT, unsigned long long);
+static void Resize(ConcurrentHashPtrT, EpochSlotPtrT, size_t);
+
+/* ,        .  ,   *
+ *                                                                       */
+static EpochSlotPtrT EnterEpoch(ConcurrentHashPtrT table) {
+    EpochSlotPtrT slot;
+    unsigned long epoch;
+    unsigned int i;
+    int expected;
+    
+    if(threadNumber == 0)
+        threadNumber = atomic_fetch_add(&nextThreadNumber, 1);
+    for(i = threadNumber;; i++) {
+        slot = &table->slots[i % EPOCH_SLOT_COUNT];
+        expected = 0;
+        if(atomic_load_explicit(&slot->busy, memory_order_relaxed) == 0 &&
+           atomic_compare_exchange_strong(&slot->busy, &expected, 1))
+            break;
+    }
+    do {
+        epoch = atomic_load(&table->epoch);
+        atomic_store(&slot->epoch, epoch);
+    } while(atomic_load(&table->epoch) != epoch);
+    return slot;
+}
+
+static void LeaveEpoch(EpochSlotPtrT slot) {
+    atomic_store_explicit(&slot->epoch, 0, memory_order_release);
+    atomic_store_explicit(&slot->busy, 0, memory_order_release);
+}
+
+static void RetirePair(ConcurrentHashPtrT table, EpochSlotPtrT slot, ConcurrentPairPtrT pair, int freeMask) {
+    pair->freeMask = freeMask;
+    pair->retireEpoch = atomic_load(&table->epoch);
+    pair->nextRetired = slot->retiredPair;
+    slot->retiredPair = pair;
+    if(++slot->retiredCount >= RECLAIM_THRESHOLD)
+        Reclaim(table, slot);
+}
+
+static void RetireArray(ConcurrentHashPtrT table, EpochSlotPtrT slot, BucketArrayPtrT array) {
+    array->retireEpoch = atomic_load(&table->epoch);
+    array->nextRetired = slot->retiredArray;
+    slot->retiredArray = array;
+    if(++slot->retiredCount >= RECLAIM_THRESHOLD)
+        Reclaim(table, slot);
+}
+
+/* ,        ,    *
+ *    .      retiredCount,         *
+ *   ,   RECLAIM_THRESHOLD                                           */
+static void Reclaim(ConcurrentHashPtrT table, EpochSlotPtrT slot) {
+    unsigned long epoch = atomic_load(&table->epoch), slotEpoch;
+    ConcurrentPairPtrT pair = slot->retiredPair, nextPair;
+    BucketArrayPtrT array = slot->retiredArray, nextArray;
+    int i;
+    
+    for(i = 0; i < EPOCH_SLOT_COUNT; i++) {
+        slotEpoch = atomic_load(&table->slots[i].epoch);
+        if(slotEpoch != 0 && slotEpoch != epoch) break;
+    }
+    if(i == EPOCH_SLOT_COUNT && atomic_compare_exchange_strong(&table->epoch, &epoch, epoch + 1))
+        epoch++;
+    
+    slot->retiredPair = NULL;
+    slot->retiredArray = NULL;
+    slot->retiredCount = 0;
+    for(; pair != NULL; pair = nextPair) {
+        nextPair = pair->nextRetired;
+        if(pair->retireEpoch + 2 <= epoch) {
+            FreePair(pair, pair->freeMask);
+            continue;
+        }
+        pair->nextRetired = slot->retiredPair;
+        slot->retiredPair = pair;
+    }
+    for(; array != NULL; array = nextArray) {
+        nextArray = array->nextRetired;
+        if(array->retireEpoch + 2 <= epoch) {
+            FreeBucketArray(array, 0);
+            continue;
+        }
+        array->nextRetired = slot->retiredArray;
+        slot->retiredArray = array;
+    }
+}
+
+static void FreePair(ConcurrentPairPtrT pair, int freeMask) {
+    if(freeMask & FREE_KEY) free(pair->key);
+    if(freeMask & FREE_VALUE) free(pair->value);
+    free(pair);
+}
+
+static BucketArrayPtrT CreateBucketArray(size_t count) {
+    BucketArrayPtrT array = (BucketArrayPtrT)malloc(sizeof(BucketArrayT) + count * sizeof(_Atomic(ConcurrentPairPtrT)));
+    size_t i;
+    
+    if(array == NULL) return NULL;
+    array->count = count;
+    for(i = 0; i < count; i++)
+        atomic_init(&array->bucket[i], NULL);
+    return array;
+}
+
+static void FreeBucketArray(BucketArrayPtrT array, int freeMask) {
+    ConcurrentPairPtrT pair, next;
+    size_t i;
+    
+    for(i = 0; i < array->count; i++) {
+        for(pair = atomic_load(&array->bucket[i]); pair != NULL; pair = next) {
+            next = atomic_load(&pair->next);
+            FreePair(pair, freeMask);
+        }
+    }
+    free(array);
+}
+
+static size_t GetBucketIndex(unsigned long long hash, size_t count) {
+    return (size_t)(((hash >> 32) * count) >> 32);
+}
+
+static size_t GetStripeIndex(unsigned long long hash) {
+    return (size_t)(hash >> (64 - STRIPE_BITS));
+}
+
+/* ,  ,      ,   NULL  */
+static _Atomic(ConcurrentPairPtrT)* FindLink(ConcurrentHashPtrT table, BucketArrayPtrT array, LSQ_KeyT key, unsigned long long hash) {
+    _Atomic(ConcurrentPairPtrT)* link = &array->bucket[GetBucketIndex(hash, array->count)];
+    ConcurrentPairPtrT pair;
+    
+    while((pair = atomic_load(link)) != NULL && (pair->hash != hash || table->kcompareFunction(pair->key, key)))
+        link = &pair->next;
+    return link;
+}
+
+/*     :   ,     .   *
+ *    :     ,           */
+static ConcurrentPairPtrT FindPair(ConcurrentHashPtrT table, BucketArrayPtrT array, LSQ_KeyT key, unsigned long long hash) {
+    ConcurrentPairPtrT pair = atomic_load(&array->bucket[GetBucketIndex(hash, array->count)]);
+    
+    while(pair != NULL && (pair->hash != hash || table->kcompareFunction(pair->key, key)))
+        pair = atomic_load(&pair->next);
+    return pair;
+}
+
+/* ,    count    ,     .  *
+ *      ,                                        */
+static void Resize(ConcurrentHashPtrT table, EpochSlotPtrT slot, size_t count) {
+    BucketArrayPtrT array = NULL, oldArray;
+    ConcurrentPairPtrT pair, copy;
+    _Atomic(ConcurrentPairPtrT)* bucket;
+    size_t size, i;
+    
+    for(i = 0; i < STRIPE_COUNT; i++)
+        pthread_mutex_lock(&table->stripes[i].mutex);
+    oldArray = atomic_load(&table->buckets);
+    size = (size_t)atomic_load(&table->size);
+    if((count > oldArray->count && size > oldArray->count * MAXIMAL_LOAD_FACTOR) ||
+       (count < oldArray->count && count >= INITIAL_TABLE_SIZE && size * MINIMAL_LOAD_FACTOR < oldArray->count))
+        array = CreateBucketArray(count);
+    for(i = 0; array != NULL && i < oldArray->count; i++) {
+        for(pair = atomic_load(&oldArray->bucket[i]); pair != NULL; pair = atomic_load(&pair->next)) {
+            copy = (ConcurrentPairPtrT)malloc(sizeof(ConcurrentPairT));
+            if(copy == NULL) {
+                FreeBucketArray(array, 0);
+                array = NULL;
+                break;
+            }
+            *copy = *pair;
+            bucket = &array->bucket[GetBucketIndex(pair->hash, count)];
+            atomic_init(&copy->next, atomic_load(bucket));
+            atomic_store(bucket, copy);
+        }
+    }
+    if(array != NULL) {
+        atomic_store(&table->buckets, array);
+        RetireArray(table, slot, oldArray);
+    }
+    for(i = STRIPE_COUNT; i > 0; i--)
+        pthread_mutex_unlock(&table->stripes[i - 1].mutex);
+}
+
+extern LSQ_ConcurrentHashT LSQ_CreateConcurrentHash(LSQ_Callback_CloneFuncT keyCloneFunc, LSQ_Callback_SizeFuncT keySizeFunc, 
+                                                    LSQ_Callback_CompareFuncT keyCompFunc, LSQ_Callback_CloneFuncT valCloneFunc)
+{
+    ConcurrentHashPtrT table = (ConcurrentHashPtrT)aligned_alloc(CACHE_LINE_SIZE, sizeof(ConcurrentHashT));
+    BucketArrayPtrT array = CreateBucketArray(INITIAL_TABLE_SIZE);
+    int i;
+    
+    if(table != NULL) {
+        table->stripes = (StripeT*)aligned_alloc(CACHE_LINE_SIZE, sizeof(StripeT) * STRIPE_COUNT);
+        table->slots = (EpochSlotPtrT)aligned_alloc(CACHE_LINE_SIZE, sizeof(EpochSlotT) * EPOCH_SLOT_COUNT);
+    }
+    if(table == NULL || array == NULL || table->stripes == NULL || table->slots == NULL) {
+        if(table != NULL) {
+            free(table->stripes);
+            free(table->slots);
+        }
+        free(table);
+        free(array);
+        return LSQ_ConcurrentHashInvalid;
+    }
+    for(i = 0; i < STRIPE_COUNT; i++)
+        pthread_mutex_init(&table->stripes[i].mutex, NULL);
+    for(i = 0; i < EPOCH_SLOT_COUNT; i++) {
+        atomic_init(&table->slots[i].epoch, 0);
+        atomic_init(&table->slots[i].busy, 0);
+        table->slots[i].retiredPair = NULL;
+        table->slots[i].retiredArray = NULL;
+        table->slots[i].retiredCount = 0;
+    }
+    atomic_init(&table->buckets, array);
+    atomic_init(&table->size, 0);
+    atomic_init(&table->epoch, 1);
+    table->kcloneFunction   = keyCloneFunc;
+    table->kcompareFunction = keyCompFunc;
+    table->ksizeFunction    = keySizeFunc;
+    table->vcloneFunction   = valCloneFunc;
+    table->seed             = GenerateHashSeed();
+    return table;
+}
+
+extern void LSQ_DestroyConcurrentHash(LSQ_ConcurrentHashT table) {
+    ConcurrentHashPtrT pointer = (ConcurrentHashPtrT)table;
+    BucketArrayPtrT array, nextArray;
+    ConcurrentPairPtrT pair, next;
+    size_t i;
+    
+    if(pointer == LSQ_ConcurrentHashInvalid) return;
+    FreeBucketArray(atomic_load(&pointer->buckets), FREE_KEY | FREE_VALUE);
+    for(i = 0; i < EPOCH_SLOT_COUNT; i++) {
+        for(pair = pointer->slots[i].retiredPair; pair != NULL; pair = next) {
+            next = pair->nextRetired;
+            FreePair(pair, pair->freeMask);
+        }
+        for(array = pointer->slots[i].retiredArray; array != NULL; array = nextArray) {
+            nextArray = array->nextRetired;
+            FreeBucketArray(array, 0);
+        }
+    }
+    for(i = 0; i < STRIPE_COUNT; i++)
+        pthread_mutex_destroy(&pointer->stripes[i].mutex);
+    free(pointer->stripes);
+    free(pointer->slots);
+    free(pointer);
+}
+
+extern LSQ_SizeT LSQ_ConcurrentGetSize(LSQ_ConcurrentHashT table) {
+    if(table == LSQ_ConcurrentHashInvalid) return 0;
+    return (LSQ_SizeT)atomic_load(&((ConcurrentHashPtrT)table)->size);
+}
+
+extern LSQ_BaseTypeT LSQ_ConcurrentGetElement(LSQ_ConcurrentHashT table, LSQ_KeyT key) {
+    ConcurrentHashPtrT pointer = (ConcurrentHashPtrT)table;
+    LSQ_BaseTypeT value = NULL;
+    ConcurrentPairPtrT pair;
+    EpochSlotPtrT slot;
+    unsigned long long hash;
+    
+    if(pointer == LSQ_ConcurrentHashInvalid) return NULL;
+    hash = HashBytes(key, pointer->ksizeFunction(key), pointer->seed);
+    slot = EnterEpoch(pointer);
+    pair = FindPair(pointer, atomic_load(&pointer->buckets), key, hash);
+    if(pair != NULL) value = pointer->vcloneFunction(pair->value);
+    LeaveEpoch(slot);
+    return value;
+}
+
+/*           :     *
+ *  ,  ,                                     */
+extern int LSQ_ConcurrentInsertElement(LSQ_ConcurrentHashT table, LSQ_KeyT key, LSQ_BaseTypeT value) {
+    ConcurrentHashPtrT pointer = (ConcurrentHashPtrT)table;
+    ConcurrentPairPtrT pair, newPair;
+    _Atomic(ConcurrentPairPtrT)* link;
+    BucketArrayPtrT array;
+    EpochSlotPtrT slot;
+    unsigned long long hash;
+    StripeT* stripe;
+    long size = 0;
+    
+    if(pointer == LSQ_ConcurrentHashInvalid) return 0;
+    newPair = (ConcurrentPairPtrT)malloc(sizeof(ConcurrentPairT));
+    if(newPair == NULL) return 0;
+    hash = HashBytes(key, pointer->ksizeFunction(key), pointer->seed);
+    newPair->hash = hash;
+    newPair->value = pointer->vcloneFunction(value);
+    
+    slot = EnterEpoch(pointer);
+    stripe = &pointer->stripes[GetStripeIndex(hash)];
+    pthread_mutex_lock(&stripe->mutex);
+    array = atomic_load(&pointer->buckets);
+    link = FindLink(pointer, array, key, hash);
+    pair = atomic_load(link);
+    if(pair != NULL) {
+        newPair->key = pair->key;
+        atomic_init(&newPair->next, atomic_load(&pair->next));
+        atomic_store(link, newPair);
+        RetirePair(pointer, slot, pair, FREE_VALUE);
+    }
+    else {
+        newPair->key = pointer->kcloneFunction(key);
+        atomic_init(&newPair->next, atomic_load(link));
+        atomic_store(link, newPair);
+        size = atomic_fetch_add(&pointer->size, 1) + 1;
+    }
+    pthread_mutex_unlock(&stripe->mutex);
+    
+    if((size_t)size > array->count * MAXIMAL_LOAD_FACTOR) Resize(pointer, slot, array->count * 2);
+    LeaveEpoch(slot);
+    return 1;
+}
+
+extern void LSQ_ConcurrentDeleteElement(LSQ_ConcurrentHashT table, LSQ_KeyT key) {
+    ConcurrentHashPtrT pointer = (ConcurrentHashPtrT)table;
+    _Atomic(ConcurrentPairPtrT)* link;
+    ConcurrentPairPtrT pair;
+    BucketArrayPtrT array;
+    EpochSlotPtrT slot;
+    unsigned long long hash;
+    StripeT* stripe;
+    long size = -1;
+    
+    if(pointer == LSQ_ConcurrentHashInvalid) return;
+    hash = HashBytes(key, pointer->ksizeFunction(key), pointer->seed);
+    slot = EnterEpoch(pointer);
+    stripe = &pointer->stripes[GetStripeIndex(hash)];
+    pthread_mutex_lock(&stripe->mutex);
+    array = atomic_load(&pointer->buckets);
+    link = FindLink(pointer, array, key, hash);
+    pair = atomic_load(link);
+    if(pair != NULL) {
+        atomic_store(link, atomic_load(&pair->next));
+        RetirePair(pointer, slot, pair, FREE_KEY | FREE_VALUE);
+        size = atomic_fetch_sub(&pointer->size, 1) - 1;
+    }
+    pthread_mutex_unlock(&stripe->mutex);
+    
+    if(size >= 0 && array->count > INITIAL_TABLE_SIZE && (size_t)size * MINIMAL_LOAD_FACTOR < array->count) 
+        Resize(pointer, slot, array->count / 2);
+    LeaveEpoch(slot);
+}
@@ -0,0 +1,31 @@
+#ifndef CONCURRENT_HASH_H
+#define CONCURRENT_HASH_H
+
+#include "linear_sequence_assoc_hash.h"
+
+/*  -,      */
+typedef void* LSQ_ConcurrentHashT;
+
+/*     */
+#define LSQ_ConcurrentHashInvalid NULL
+
+/* ,   .     ,    LSQ_CreateSequence */
+extern LSQ_ConcurrentHashT LSQ_CreateConcurrentHash(LSQ_Callback_CloneFuncT keyCloneFunc, LSQ_Callback_SizeFuncT keySizeFunc, 
+                                                    LSQ_Callback_CompareFuncT keyCompFunc, LSQ_Callback_CloneFuncT valCloneFunc);
+/* ,  . ,          */
+extern void LSQ_DestroyConcurrentHash(LSQ_ConcurrentHashT table);
+
+/* ,   .      */
+extern LSQ_SizeT LSQ_ConcurrentGetSize(LSQ_ConcurrentHashT table);
+
+/*         */
+/* ,       ,  valCloneFunc,  NULL,    *
+ *  .    .                          */
+extern LSQ_BaseTypeT LSQ_ConcurrentGetElement(LSQ_ConcurrentHashT table, LSQ_KeyT key);
+/* ,    -     . *
+ *  0                                                                   */
+extern int LSQ_ConcurrentInsertElement(LSQ_ConcurrentHashT table, LSQ_KeyT key, LSQ_BaseTypeT value);
+/* ,      */
+extern void LSQ_ConcurrentDeleteElement(LSQ_ConcurrentHashT table, LSQ_KeyT key);
+
+#endif
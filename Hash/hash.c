@@ -1,8 +1,36 @@
 #include "linear_sequence_assoc_hash.h"
+#include "key_hash.h"
+#include "swiss_table.h"
+#include "bloom_filter.h"
 #include <stdlib.h>
-#include <math.h>
+#include <string.h>
 
-#define SIZE_OF_TABLE 1000
+/*      .   ,    ,    *
+ * ,   ,      .           *
+ *    :      REHASH_STEP        *
+ *   REHASH_STEP    .                                                 */
+#define INITIAL_TABLE_SIZE 16
+#define MAXIMAL_LOAD_FACTOR 1
+#define MINIMAL_LOAD_FACTOR 8
+#define REHASH_STEP 16
+
+/*        ,        .        *
+ * NO_PAIR  , DELETED_PAIR   next   .       *
+ *  ,  ,  :        *
+ *  ,  ,    ,                 */
+#define NO_PAIR ((size_t)-1)
+#define DELETED_PAIR ((size_t)-2)
+
+/*       BATCH_SIZE:       , *
+ *                                                                                     */
+#define BATCH_SIZE 32
+
+/*       ,     (  )      *
+ *  ,   ,            *
+ * 1/BLOOM_DELETED_FRACTION .            *
+ * :        BLOOM_REBUILD_STEP                             */
+#define BLOOM_REBUILD_STEP 64
+#define BLOOM_DELETED_FRACTION 4
 
 typedef enum IteratorType {
     ITERATOR_DEREFERENCABLE,
@@ -13,48 +41,379 @@ typedef enum IteratorType {
 typedef struct Pair {
     LSQ_KeyT key;
     LSQ_BaseTypeT value;
-    struct Pair *next;
+    unsigned long long hash;
+    size_t keySize;
+    size_t next;
 }   PairT, *PairPtrT;
 
+/*               charge    *
+ * referenced,   ,                     */
+typedef struct CacheInfo {
+    size_t charge;
+    unsigned char referenced;
+}   CacheInfoT, *CacheInfoPtrT;
+
+/*   ,     oldElement    migratedCount   element.   *
+ *     0  pairCount,  ,    pair    pairSize  */
 typedef struct Table {
-    LSQ_SizeT size;
-    PairPtrT *element;
+    LSQ_SizeT size, reservedSize;
+    size_t *element, *oldElement;
+    size_t bucketCount, oldBucketCount, migratedCount;
+    PairPtrT pair;
+    size_t pairCount, pairCapacity, pairSize, inlineKeyCapacity, inlineValueSize;
+    size_t compactCursor, compactedCount;
+    struct Iterator* iterators;
     
     LSQ_Callback_CloneFuncT *kcloneFunction;
     LSQ_Callback_SizeFuncT *ksizeFunction;
     LSQ_Callback_CompareFuncT *kcompareFunction;
     LSQ_Callback_CloneFuncT *vcloneFunction;
+    LSQ_Callback_HashFuncT *hashFunction;
+    unsigned long long seed;
+    SwissTablePtrT swiss;
+    
+    BloomFilterPtrT bloom, nextBloom;
+    size_t bloomCursor, bloomDeletedCount;
+    double bloomRate;
+    unsigned long long hitCount, missCount, falsePositiveCount;
+    
+    int isCache;
+    LSQ_Callback_SizeFuncT *vsizeFunction;
+    LSQ_Callback_EvictFuncT *evictFunction;
+    size_t byteBudget, entryBudget, usedBytes, clockHand, pendingPair;
+    unsigned long long evictionCount;
 }   TableT, *TablePtrT;
 
+/*      ,      */
+typedef struct SearchKey {
+    TablePtrT table;
+    LSQ_KeyT key;
+    size_t size;
+    unsigned long long hash;
+}   SearchKeyT, *SearchKeyPtrT;
+
+/*     element,   -     ,    *
+ * ,       .          *
+ *   entry.     ,            */
 typedef struct Iterator {
     IteratorTypeT type;
     TablePtrT table;
-    PairPtrT element;
+    size_t element;
+    SwissEntryPtrT entry;
+    struct Iterator *nextIterator, *previousIterator;
 }   IteratorT, *IteratorPtrT;
 
-static int CalculateHash(TablePtrT table, LSQ_KeyT key);
-static LSQ_IteratorT CreateIterator(LSQ_HandleT handle, IteratorTypeT type, PairPtrT element);
+static void PrepareSearchKey(TablePtrT table, LSQ_KeyT key, SearchKeyPtrT search);
+static unsigned long long FinalizeHash(unsigned long long hash, unsigned long long seed);
+static PairPtrT GetPair(TablePtrT table, size_t index);
+static int IsInlineKey(TablePtrT table, size_t keySize);
+static LSQ_KeyT GetStoredKey(TablePtrT table, LSQ_KeyT key, size_t keySize, void* inlineKey);
+static int IsSameKey(SearchKeyPtrT search, LSQ_KeyT key, size_t keySize, unsigned long long hash, void* inlineKey);
+static int MatchSwissEntry(const void* context, SwissEntryPtrT entry);
+static LSQ_KeyT StoreKey(SearchKeyPtrT search, void* inlineKey, int take);
+static void FreeStoredKey(TablePtrT table, LSQ_KeyT key, size_t keySize);
+static LSQ_BaseTypeT GetStoredValue(TablePtrT table, LSQ_BaseTypeT value, void* inlineData);
+static LSQ_BaseTypeT* GetValueSlot(TablePtrT table, LSQ_BaseTypeT* value, void* inlineData);
+static void StoreValue(TablePtrT table, LSQ_BaseTypeT* slot, LSQ_BaseTypeT value, int take);
+static void FreeStoredValue(TablePtrT table, LSQ_BaseTypeT value);
+static void SetInlineStorage(TablePtrT table, size_t keyCapacity, size_t valueSize);
+static size_t GetBucketIndex(unsigned long long hash, size_t bucketCount);
+static size_t* FindBucket(TablePtrT table, unsigned long long hash);
+static size_t* FindPair(TablePtrT table, SearchKeyPtrT search);
+static void MigrateBuckets(TablePtrT table, size_t count);
+static int StartResize(TablePtrT table, size_t bucketCount);
+static size_t* CreateBuckets(size_t bucketCount);
+static void MovePair(TablePtrT table, size_t from, size_t to);
+static void CompactPairs(TablePtrT table, size_t count);
+static size_t GetRequiredBucketCount(LSQ_SizeT size);
+static LSQ_IteratorT CreateIterator(LSQ_HandleT handle, IteratorTypeT type, size_t element);
+static void SeekPair(IteratorPtrT iterator, size_t element);
+static LSQ_BaseTypeT* FindOrInsertSlot(TablePtrT table, LSQ_KeyT key, int take, int* inserted);
+static int IsFilteredOut(TablePtrT table, unsigned long long hash);
+static void CountMiss(TablePtrT table);
+static void AddToFilters(TablePtrT table, unsigned long long hash);
+static void StartFilterRebuild(TablePtrT table);
+static void RebuildFilters(TablePtrT table, size_t count);
+static void CountFilterDeletion(TablePtrT table);
+static void RemovePair(TablePtrT table, size_t* link);
+static CacheInfoPtrT GetCacheInfo(TablePtrT table, size_t index);
+static void CountHit(TablePtrT table, size_t element);
+static int IsOverBudget(TablePtrT table, size_t extraBytes, size_t extraCount);
+static void EvictPairs(TablePtrT table, size_t extraBytes, size_t extraCount);
+static void SettlePendingPair(TablePtrT table);
+
+/*          seed */
+void PrepareSearchKey(TablePtrT table, LSQ_KeyT key, SearchKeyPtrT search) {
+    search->table = table;
+    search->key = key;
+    search->size = table->ksizeFunction(key);
+    search->hash = table->hashFunction(key, search->size, table->seed);
+    if(table->hashFunction != HashBytes) search->hash = FinalizeHash(search->hash, table->seed);
+}
+
+/* ,          ,       *
+ * , , 32- .    ,       */
+unsigned long long FinalizeHash(unsigned long long hash, unsigned long long seed) {
+    hash ^= seed;
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+PairPtrT GetPair(TablePtrT table, size_t index) {
+    return (PairPtrT)((char*)table->pair + index * table->pairSize);
+}
+
+/*   inlineKeyCapacity       ,   ,   *
+ *      keyCloneFunc.    memcmp  keyCompFunc       */
+int IsInlineKey(TablePtrT table, size_t keySize) {
+    return keySize < table->inlineKeyCapacity;
+}
+
+/* ,     :      inlineKey,  -   key */
+LSQ_KeyT GetStoredKey(TablePtrT table, LSQ_KeyT key, size_t keySize, void* inlineKey) {
+    return IsInlineKey(table, keySize) ? inlineKey : key;
+}
+
+/*       ,   - memcmp,   - keyCompFunc */
+int IsSameKey(SearchKeyPtrT search, LSQ_KeyT key, size_t keySize, unsigned long long hash, void* inlineKey) {
+    if(hash != search->hash || keySize != search->size) return 0;
+    if(IsInlineKey(search->table, keySize)) return !memcmp(inlineKey, search->key, keySize);
+    return !search->table->kcompareFunction(key, search->key);
+}
+
+int MatchSwissEntry(const void* context, SwissEntryPtrT entry) {
+    return IsSameKey((SearchKeyPtrT)context, entry->key, entry->keySize, entry->hash, entry + 1);
+}
+
+/* ,    key  .     inlineKey,   take *
+ *   .    keyCloneFunc,   take          */
+LSQ_KeyT StoreKey(SearchKeyPtrT search, void* inlineKey, int take) {
+    if(!IsInlineKey(search->table, search->size)) return take ? search->key : search->table->kcloneFunction(search->key);
+    memcpy(inlineKey, search->key, search->size);
+    ((unsigned char*)inlineKey)[search->size] = 0;
+    if(take) free(search->key);
+    return NULL;
+}
+
+void FreeStoredKey(TablePtrT table, LSQ_KeyT key, size_t keySize) {
+    if(!IsInlineKey(table, keySize)) free(key);
+}
+
+/*  inlineValueSize,   0,            , *
+ *  memcpy  valCloneFunc,    value                                            */
+LSQ_BaseTypeT GetStoredValue(TablePtrT table, LSQ_BaseTypeT value, void* inlineData) {
+    return table->inlineValueSize > 0 ? (char*)inlineData + table->inlineKeyCapacity : value;
+}
+
+/* ,   value      .      *
+ *   , ,                                 */
+LSQ_BaseTypeT* GetValueSlot(TablePtrT table, LSQ_BaseTypeT* value, void* inlineData) {
+    *value = GetStoredValue(table, *value, inlineData);
+    return value;
+}
+
+/* ,     slot,   GetValueSlot.   ,   *
+ * take  .    ,    valCloneFunc ,    *
+ *  take,                                                                                    */
+void StoreValue(TablePtrT table, LSQ_BaseTypeT* slot, LSQ_BaseTypeT value, int take) {
+    if(table->inlineValueSize > 0) {
+        memcpy(*slot, value, table->inlineValueSize);
+        if(take) free(value);
+        return;
+    }
+    free(*slot);
+    *slot = take ? value : table->vcloneFunction(value);
+}
+
+void FreeStoredValue(TablePtrT table, LSQ_BaseTypeT value) {
+    if(table->inlineValueSize == 0) free(value);
+}
+
+/*      ,         */
+size_t GetBucketIndex(unsigned long long hash, size_t bucketCount) {
+    return (size_t)(((hash >> 32) * bucketCount) >> 32);
+}
+
+/* ,  ,         */
+size_t* FindBucket(TablePtrT table, unsigned long long hash) {
+    size_t index;
+    
+    if(table->oldElement != NULL) {
+        index = GetBucketIndex(hash, table->oldBucketCount);
+        if(index >= table->migratedCount) return &table->oldElement[index];
+    }
+    return &table->element[GetBucketIndex(hash, table->bucketCount)];
+}
+
+/* ,    ,      ,    NO_PAIR . *
+ *                                                             */
+size_t* FindPair(TablePtrT table, SearchKeyPtrT search) {
+    size_t* link = FindBucket(table, search->hash);
+    PairPtrT pair;
+    
+    while(*link != NO_PAIR) {
+        pair = GetPair(table, *link);
+        if(IsSameKey(search, pair->key, pair->keySize, pair->hash, pair + 1)) break;
+        link = &pair->next;
+    }
+    return link;
+}
+
+/* ,   count     .     */
+void MigrateBuckets(TablePtrT table, size_t count) {
+    size_t element, next, *bucket;
+    
+    for(; count > 0 && table->oldElement != NULL; count--) {
+        for(element = table->oldElement[table->migratedCount]; element != NO_PAIR; element = next) {
+            next = GetPair(table, element)->next;
+            bucket = &table->element[GetBucketIndex(GetPair(table, element)->hash, table->bucketCount)];
+            GetPair(table, element)->next = *bucket;
+            *bucket = element;
+        }
+        table->oldElement[table->migratedCount] = NO_PAIR;
+        if(++table->migratedCount == table->oldBucketCount) {
+            free(table->oldElement);
+            table->oldElement = NULL;
+        }
+    }
+}
+
+/* ,        bucketCount .   *
+ *  .  0                                       */
+int StartResize(TablePtrT table, size_t bucketCount) {
+    size_t* element;
+    
+    MigrateBuckets(table, table->oldBucketCount);
+    element = CreateBuckets(bucketCount);
+    if(element == NULL) return 0;
+    table->oldElement = table->element;
+    table->oldBucketCount = table->bucketCount;
+    table->migratedCount = 0;
+    table->element = element;
+    table->bucketCount = bucketCount;
+    return 1;
+}
 
-int CalculateHash(TablePtrT table, LSQ_KeyT key) {
-    int i, size = table->ksizeFunction(key);
-    double intPart, M = SIZE_OF_TABLE - 1, K = 0.618003;
-    unsigned int X = 0;
+/* ,    bucketCount   */
+size_t* CreateBuckets(size_t bucketCount) {
+    size_t* element = (size_t*)malloc(bucketCount * sizeof(size_t));
+    size_t i;
     
-    for(i = 0; i < size; ++i) 
-        X += ((char*)key)[i] * i;
+    if(element == NULL) return NULL;
+    for(i = 0; i < bucketCount; i++)
+        element[i] = NO_PAIR;
+    return element;
+}
 
-    return (int)(M * modf(K * X, &intPart)); 
+/* ,    from   to,       to  from . *
+ *     ,   ,     ,        *
+ *     ,                                             */
+void MovePair(TablePtrT table, size_t from, size_t to) {
+    PairPtrT pair = GetPair(table, from);
+    IteratorPtrT iterator;
+    size_t* link;
+    
+    for(link = FindBucket(table, pair->hash); *link != from; link = &GetPair(table, *link)->next);
+    *link = to;
+    memcpy(GetPair(table, to), pair, table->pairSize);
+    pair->next = DELETED_PAIR;
+    for(iterator = table->iterators; iterator != NULL; iterator = iterator->nextIterator)
+        if(iterator->type == ITERATOR_DEREFERENCABLE && iterator->element == from) iterator->element = to;
+    if(table->pendingPair == from) table->pendingPair = to;
+    if(table->clockHand >= to && table->clockHand <= from) table->clockHand = to;
+    if(table->bloomCursor >= to && table->bloomCursor <= from) table->bloomCursor = to;
+}
+
+/* ,  count   :   compactCursor    *
+ * compactedCount,     .   ,     *
+ * ,                                                                           */
+void CompactPairs(TablePtrT table, size_t count) {
+    size_t capacity = table->pairCapacity;
+    PairPtrT pair;
+    
+    if(table->compactCursor == NO_PAIR) return;
+    for(; count > 0 && table->compactCursor < table->pairCount; count--, table->compactCursor++) {
+        if(GetPair(table, table->compactCursor)->next == DELETED_PAIR) continue;
+        if(table->compactCursor != table->compactedCount) MovePair(table, table->compactCursor, table->compactedCount);
+        table->compactedCount++;
+    }
+    if(table->compactCursor < table->pairCount) return;
+    table->pairCount = table->compactedCount;
+    table->compactCursor = NO_PAIR;
+    if(table->clockHand > table->pairCount) table->clockHand = table->pairCount;
+    if(table->bloomCursor > table->pairCount) table->bloomCursor = table->pairCount;
+    while(capacity > INITIAL_TABLE_SIZE && table->pairCount * 4 < capacity)
+        capacity /= 2;
+    if(capacity == table->pairCapacity) return;
+    pair = (PairPtrT)realloc(table->pair, capacity * table->pairSize);
+    if(pair == NULL) return;
+    table->pair = pair;
+    table->pairCapacity = capacity;
+}
+
+/* ,       size  */
+size_t GetRequiredBucketCount(LSQ_SizeT size) {
+    size_t count = INITIAL_TABLE_SIZE;
+    
+    while(count * MAXIMAL_LOAD_FACTOR < (size_t)size)
+        count *= 2;
+    return count;
 }
 
 extern LSQ_HandleT LSQ_CreateSequence(LSQ_Callback_CloneFuncT keyCloneFunc, LSQ_Callback_SizeFuncT keySizeFunc, 
                                       LSQ_Callback_CompareFuncT keyCompFunc, LSQ_Callback_CloneFuncT valCloneFunc) 
+{    
+    return LSQ_CreateSequenceWithLayout(keyCloneFunc, keySizeFunc, keyCompFunc, valCloneFunc, NULL, LSQ_LAYOUT_CHAINED);
+}
+
+extern LSQ_HandleT LSQ_CreateSequenceWithHash(LSQ_Callback_CloneFuncT keyCloneFunc, LSQ_Callback_SizeFuncT keySizeFunc, 
+                                              LSQ_Callback_CompareFuncT keyCompFunc, LSQ_Callback_CloneFuncT valCloneFunc,
+                                              LSQ_Callback_HashFuncT hashFunc)
+{    
+    return LSQ_CreateSequenceWithLayout(keyCloneFunc, keySizeFunc, keyCompFunc, valCloneFunc, hashFunc, LSQ_LAYOUT_CHAINED);
+}
+
+extern LSQ_HandleT LSQ_CreateSequenceWithLayout(LSQ_Callback_CloneFuncT keyCloneFunc, LSQ_Callback_SizeFuncT keySizeFunc, 
+                                                LSQ_Callback_CompareFuncT keyCompFunc, LSQ_Callback_CloneFuncT valCloneFunc,
+                                                LSQ_Callback_HashFuncT hashFunc, LSQ_SequenceLayoutT layout)
 {    
     TablePtrT table = (TablePtrT)malloc(sizeof(TableT));
     if(table == NULL) return LSQ_HandleInvalid;
-    table->size = 0;
-    table->element = (PairPtrT*)calloc(SIZE_OF_TABLE, sizeof(PairT));
+    table->size = table->reservedSize = 0;
+    table->bucketCount = 0;
+    table->oldElement = table->element = NULL;
+    table->oldBucketCount = table->migratedCount = 0;
+    table->pair = NULL;
+    table->pairCount = table->pairCapacity = 0;
+    table->pairSize = sizeof(PairT);
+    table->inlineKeyCapacity = table->inlineValueSize = 0;
+    table->compactCursor = NO_PAIR;
+    table->compactedCount = 0;
+    table->iterators = NULL;
+    table->swiss = NULL;
+    table->bloom = table->nextBloom = NULL;
+    table->bloomCursor = table->bloomDeletedCount = 0;
+    table->bloomRate = 0.0;
+    table->hitCount = table->missCount = table->falsePositiveCount = 0;
+    table->isCache = 0;
+    table->vsizeFunction = NULL;
+    table->evictFunction = NULL;
+    table->byteBudget = table->entryBudget = table->usedBytes = table->clockHand = 0;
+    table->pendingPair = NO_PAIR;
+    table->evictionCount = 0;
+    if(layout == LSQ_LAYOUT_OPEN_ADDRESSING) {
+        table->swiss = CreateSwissTable(0);
+    }
+    else {
+        table->bucketCount = INITIAL_TABLE_SIZE;
+        table->element = CreateBuckets(INITIAL_TABLE_SIZE);
+    }
     
-    if(table->element == NULL) {
+    if(table->element == NULL && table->swiss == NULL) {
         free(table);   
         return LSQ_HandleInvalid;
     }
@@ -62,26 +421,36 @@ extern LSQ_HandleT LSQ_CreateSequence(LSQ_Callback_CloneFuncT keyCloneFunc, LSQ_
     table->kcompareFunction = keyCompFunc;
     table->ksizeFunction    = keySizeFunc;
     table->vcloneFunction   = valCloneFunc;
+    table->hashFunction     = hashFunc != NULL ? hashFunc : HashBytes;
+    table->seed             = GenerateHashSeed();
     return table;
 }
 
 extern void LSQ_DestroySequence(LSQ_HandleT handle) {
     if(handle == LSQ_HandleInvalid) return;
-    PairPtrT element = NULL, previousElement = NULL;
     TablePtrT table = (TablePtrT)handle;
-    int i;
-    
-    for(i = 0; i < SIZE_OF_TABLE; i++) {
-        element = table->element[i];
-        while(element != NULL) {
-            previousElement = element;
-            element = element->next;
-            free(previousElement->value);
-            free(previousElement->key);
-            free(previousElement);
+    SwissEntryPtrT entry = NULL;
+    PairPtrT pair;
+    size_t i;
+    
+    if(table->swiss != NULL) {
+        while((entry = GetNextSwissEntry(table->swiss, entry)) != NULL) {
+            FreeStoredValue(table, entry->value);
+            FreeStoredKey(table, entry->key, entry->keySize);
         }
+        DestroySwissTable(table->swiss);
     }
+    for(i = 0; i < table->pairCount; i++) {
+        pair = GetPair(table, i);
+        if(pair->next == DELETED_PAIR) continue;
+        FreeStoredValue(table, pair->value);
+        FreeStoredKey(table, pair->key, pair->keySize);
+    }
+    free(table->pair);
+    free(table->oldElement);
     free(table->element);
+    DestroyBloomFilter(table->bloom);
+    DestroyBloomFilter(table->nextBloom);
     free(table);
 }
 
@@ -107,15 +476,27 @@ extern int LSQ_IsIteratorBeforeFirst(LSQ_IteratorT iterator) {
 
 extern LSQ_BaseTypeT LSQ_DereferenceIterator(LSQ_IteratorT iterator) {
     if(iterator == NULL || !LSQ_IsIteratorDereferencable(iterator)) return NULL;
-    return ((IteratorPtrT)iterator)->element->value;    
+    IteratorPtrT iter = (IteratorPtrT)iterator;
+    
+    PairPtrT pair;
+    
+    if(iter->entry != NULL) return GetStoredValue(iter->table, iter->entry->value, iter->entry + 1);
+    pair = GetPair(iter->table, iter->element);
+    return GetStoredValue(iter->table, pair->value, pair + 1);
 }
 
 extern LSQ_KeyT LSQ_GetIteratorKey(LSQ_IteratorT iterator) {
     if(iterator == NULL || !LSQ_IsIteratorDereferencable(iterator)) return NULL;
-    return ((IteratorPtrT)iterator)->element->key;    
+    IteratorPtrT iter = (IteratorPtrT)iterator;
+    
+    PairPtrT pair;
+    
+    if(iter->entry != NULL) return GetStoredKey(iter->table, iter->entry->key, iter->entry->keySize, iter->entry + 1);
+    pair = GetPair(iter->table, iter->element);
+    return GetStoredKey(iter->table, pair->key, pair->keySize, pair + 1);
 }
 
-LSQ_IteratorT CreateIterator(LSQ_HandleT handle, IteratorTypeT type, PairPtrT element) {
+LSQ_IteratorT CreateIterator(LSQ_HandleT handle, IteratorTypeT type, size_t element) {
     if(handle == LSQ_HandleInvalid) return NULL;
     IteratorPtrT iterator = (IteratorPtrT)malloc(sizeof(IteratorT));
     if(iterator == NULL) return NULL;
@@ -123,38 +504,141 @@ LSQ_IteratorT CreateIterator(LSQ_HandleT handle, IteratorTypeT type, PairPtrT el
     iterator->table = (TablePtrT)handle;
     iterator->type = type;
     iterator->element = element;
+    iterator->entry = NULL;
+    iterator->previousIterator = NULL;
+    iterator->nextIterator = iterator->table->iterators;
+    if(iterator->nextIterator != NULL) iterator->nextIterator->previousIterator = iterator;
+    iterator->table->iterators = iterator;
     return iterator;
 }
 
+/* ,           element */
+void SeekPair(IteratorPtrT iterator, size_t element) {
+    TablePtrT table = iterator->table;
+    
+    if(table->swiss != NULL) {
+        iterator->entry = GetNextSwissEntry(table->swiss, iterator->entry);
+        iterator->type = iterator->entry != NULL ? ITERATOR_DEREFERENCABLE : ITERATOR_PAST_REAR;
+        return;
+    }
+    while(element < table->pairCount && GetPair(table, element)->next == DELETED_PAIR)
+        element++;
+    iterator->type = element < table->pairCount ? ITERATOR_DEREFERENCABLE : ITERATOR_PAST_REAR;
+    iterator->element = element;
+}
+
 extern LSQ_IteratorT LSQ_GetElementByIndex(LSQ_HandleT handle, LSQ_KeyT key) {
     if(handle == LSQ_HandleInvalid) return NULL;   
-    int index = CalculateHash(handle, key);
     TablePtrT table = (TablePtrT)handle;
-    PairPtrT element = table->element[index];
-        
-    while(element != NULL && table->kcompareFunction(element->key, key)) 
-        element = element->next; 
-        
-    if(element == NULL) return LSQ_GetPastRearElement(handle);
+    SearchKeyT search;
+    size_t element;
+    SwissEntryPtrT entry;
+    IteratorPtrT iterator;
+    
+    PrepareSearchKey(table, key, &search);
+    if(IsFilteredOut(table, search.hash)) return LSQ_GetPastRearElement(handle);
+    if(table->swiss != NULL) {
+        entry = FindSwissEntry(table->swiss, search.hash, MatchSwissEntry, &search);
+        if(entry == NULL) {
+            CountMiss(table);
+            return LSQ_GetPastRearElement(handle);
+        }
+        table->hitCount++;
+        iterator = CreateIterator(handle, ITERATOR_DEREFERENCABLE, 0);
+        if(iterator != NULL) iterator->entry = entry;
+        return iterator;
+    }
+    element = *FindPair(table, &search);
+    if(element == NO_PAIR) {
+        CountMiss(table);
+        return LSQ_GetPastRearElement(handle);
+    }
+    CountHit(table, element);
     return CreateIterator(handle, ITERATOR_DEREFERENCABLE, element);
 }
 
+/*        :      ,  *
+ *    ,       ,      *
+ *    , , .       ,       *
+ *                                                                                               */
+extern void LSQ_GetElementsBatch(LSQ_HandleT handle, const LSQ_KeyT* keys, size_t count, LSQ_BaseTypeT* results) {
+    if(handle == LSQ_HandleInvalid) return;
+    TablePtrT table = (TablePtrT)handle;
+    SearchKeyT search[BATCH_SIZE];
+    size_t element[BATCH_SIZE], *bucket[BATCH_SIZE];
+    int passed[BATCH_SIZE];
+    size_t first, last, i;
+    SwissEntryPtrT entry;
+    PairPtrT pair;
+    
+    for(first = 0; first < count; first += BATCH_SIZE) {
+        last = count - first < BATCH_SIZE ? count : first + BATCH_SIZE;
+        for(i = first; i < last; i++) {
+            PrepareSearchKey(table, keys[i], &search[i - first]);
+            if(table->bloom != NULL) PrefetchBloomFilterHash(table->bloom, search[i - first].hash);
+        }
+        for(i = first; i < last; i++) {
+            passed[i - first] = !IsFilteredOut(table, search[i - first].hash);
+            if(!passed[i - first]) results[i] = NULL;
+            else if(table->swiss != NULL) PrefetchSwissEntry(table->swiss, search[i - first].hash);
+            else {
+                bucket[i - first] = FindBucket(table, search[i - first].hash);
+                __builtin_prefetch(bucket[i - first]);
+            }
+        }
+        if(table->swiss != NULL) {
+            for(i = first; i < last; i++) {
+                if(!passed[i - first]) continue;
+                entry = FindSwissEntry(table->swiss, search[i - first].hash, MatchSwissEntry, &search[i - first]);
+                if(entry == NULL) CountMiss(table);
+                else table->hitCount++;
+                results[i] = entry != NULL ? GetStoredValue(table, entry->value, entry + 1) : NULL;
+            }
+            continue;
+        }
+        for(i = first; i < last; i++) {
+            element[i - first] = passed[i - first] ? *bucket[i - first] : NO_PAIR;
+            if(element[i - first] != NO_PAIR) __builtin_prefetch(GetPair(table, element[i - first]));
+        }
+        for(i = first; i < last; i++) {
+            if(element[i - first] == NO_PAIR) continue;
+            pair = GetPair(table, element[i - first]);
+            if(!IsInlineKey(table, pair->keySize)) __builtin_prefetch(pair->key);
+        }
+        for(i = first; i < last; i++) {
+            if(!passed[i - first]) continue;
+            element[i - first] = *FindPair(table, &search[i - first]);
+            if(element[i - first] == NO_PAIR) CountMiss(table);
+            else CountHit(table, element[i - first]);
+            if(element[i - first] == NO_PAIR) {
+                results[i] = NULL;
+                continue;
+            }
+            pair = GetPair(table, element[i - first]);
+            results[i] = GetStoredValue(table, pair->value, pair + 1);
+        }
+    }
+}
+
 extern LSQ_IteratorT LSQ_GetFrontElement(LSQ_HandleT handle) {
     if(handle == LSQ_HandleInvalid) return NULL;  
-    TablePtrT table = (TablePtrT)handle; 
-    int i = 0;
+    IteratorPtrT iterator = CreateIterator(handle, ITERATOR_PAST_REAR, 0);
     
-    for(; i < SIZE_OF_TABLE && table->element[i] == NULL; i++);
-        
-    if(i == SIZE_OF_TABLE) return LSQ_GetPastRearElement(handle);
-    return CreateIterator(handle, ITERATOR_DEREFERENCABLE, table->element[i]);
+    if(iterator != NULL) SeekPair(iterator, 0);
+    return iterator;
 }
 
 extern LSQ_IteratorT LSQ_GetPastRearElement(LSQ_HandleT handle) {
-    return CreateIterator(handle, ITERATOR_PAST_REAR, NULL);
+    return CreateIterator(handle, ITERATOR_PAST_REAR, 0);
 }
 
 extern void LSQ_DestroyIterator(LSQ_IteratorT iterator) {
+    if(iterator == NULL) return;
+    IteratorPtrT iter = (IteratorPtrT)iterator;
+    
+    if(iter->nextIterator != NULL) iter->nextIterator->previousIterator = iter->previousIterator;
+    if(iter->previousIterator != NULL) iter->previousIterator->nextIterator = iter->nextIterator;
+    else iter->table->iterators = iter->nextIterator;
     free(iterator);
 }
 
@@ -162,70 +646,389 @@ extern void LSQ_AdvanceOneElement(LSQ_IteratorT iterator) {
     if(iterator == NULL || LSQ_IsIteratorPastRear(iterator)) return;
     IteratorPtrT iter = (IteratorPtrT)iterator;
     
-    if(iter->element->next != NULL) {
-        iter->element = iter->element->next;
-        return;
+    SeekPair(iter, iter->element + 1);
+}
+
+/* ,               .   *
+ *  (inserted  1)  StoreKey,    NULL,    .         *
+ *     GetValueSlot  NULL   ,              */
+LSQ_BaseTypeT* FindOrInsertSlot(TablePtrT table, LSQ_KeyT key, int take, int* inserted) {
+    SearchKeyT search;
+    SwissEntryPtrT entry;
+    PairPtrT pair;
+    size_t element, *bucket;
+    
+    PrepareSearchKey(table, key, &search);
+    *inserted = 0;
+    if(table->swiss != NULL) {
+        entry = FindOrInsertSwissEntry(table->swiss, search.hash, MatchSwissEntry, &search, inserted);
+        if(entry == NULL) return NULL;
+        if(*inserted) {
+            entry->keySize = search.size;
+            entry->key = StoreKey(&search, entry + 1, take);
+            entry->value = NULL;
+            if(table->inlineValueSize > 0) memset(GetStoredValue(table, NULL, entry + 1), 0, table->inlineValueSize);
+            table->size++;
+            AddToFilters(table, search.hash);
+        }
+        return GetValueSlot(table, &entry->value, entry + 1);
+    }
+    
+    SettlePendingPair(table);
+    MigrateBuckets(table, REHASH_STEP);
+    CompactPairs(table, REHASH_STEP);
+    RebuildFilters(table, BLOOM_REBUILD_STEP);
+    element = *FindPair(table, &search);
+    if(element != NO_PAIR) {
+        if(table->isCache) {
+            GetCacheInfo(table, element)->referenced = 1;
+            table->pendingPair = element;
+        }
+        pair = GetPair(table, element);
+        return GetValueSlot(table, &pair->value, pair + 1);
+    }
+    
+    if(table->isCache) EvictPairs(table, search.size, 1);
+    if((size_t)table->size >= table->bucketCount * MAXIMAL_LOAD_FACTOR) StartResize(table, table->bucketCount * 2);
+    if(table->pairCount == table->pairCapacity) {
+        pair = (PairPtrT)realloc(table->pair, (table->pairCapacity > 0 ? table->pairCapacity * 2 : INITIAL_TABLE_SIZE) * table->pairSize);
+        if(pair == NULL) return NULL;
+        table->pair = pair;
+        table->pairCapacity = table->pairCapacity > 0 ? table->pairCapacity * 2 : INITIAL_TABLE_SIZE;
     }
     
-    int index = CalculateHash(iter->table, iter->element->key) + 1;
-    while(index < SIZE_OF_TABLE && iter->table->element[index] == NULL) index++;
+    pair = GetPair(table, table->pairCount);
+    pair->keySize = search.size;
+    pair->key = StoreKey(&search, pair + 1, take);
+    pair->value = NULL;
+    if(table->inlineValueSize > 0) memset(GetStoredValue(table, NULL, pair + 1), 0, table->inlineValueSize);
+    pair->hash = search.hash;
+    bucket = FindBucket(table, search.hash);
+    pair->next = *bucket;
+    
+    if(table->isCache) {
+        GetCacheInfo(table, table->pairCount)->charge = search.size;
+        GetCacheInfo(table, table->pairCount)->referenced = 0;
+        table->usedBytes += search.size;
+        table->pendingPair = table->pairCount;
+    }
+    *bucket = table->pairCount++;
+    table->size++;
+    *inserted = 1;
+    AddToFilters(table, search.hash);
+    return GetValueSlot(table, &pair->value, pair + 1);
+}
+
+/* ,  ,     link,     ,   */
+void RemovePair(TablePtrT table, size_t* link) {
+    PairPtrT element = GetPair(table, *link);
+    
+    if(table->isCache) table->usedBytes -= GetCacheInfo(table, *link)->charge;
+    *link = element->next;
+    element->next = DELETED_PAIR;
         
-    if(index == SIZE_OF_TABLE) {
-        iter->type = ITERATOR_PAST_REAR;
-        iter->element = NULL;   
+    FreeStoredKey(table, element->key, element->keySize);
+    FreeStoredValue(table, element->value);
+    table->size--;
+    CountFilterDeletion(table);
+    
+    if(table->compactCursor == NO_PAIR && table->pairCount > 2 * (size_t)table->size) 
+        table->compactCursor = table->compactedCount = 0;
+    
+    if(table->bucketCount > GetRequiredBucketCount(table->reservedSize) && 
+       (size_t)table->size * MINIMAL_LOAD_FACTOR < table->bucketCount)
+        StartResize(table, table->bucketCount / 2);
+}
+
+CacheInfoPtrT GetCacheInfo(TablePtrT table, size_t index) {
+    return (CacheInfoPtrT)((char*)GetPair(table, index) + table->pairSize - sizeof(CacheInfoT));
+}
+
+/* ,     element.        , *
+ *   ,                                              */
+void CountHit(TablePtrT table, size_t element) {
+    CacheInfoPtrT info;
+    
+    table->hitCount++;
+    if(!table->isCache) return;
+    info = GetCacheInfo(table, element);
+    if(!info->referenced) info->referenced = 1;
+}
+
+/* , ,     ,   extraBytes   extraCount  */
+int IsOverBudget(TablePtrT table, size_t extraBytes, size_t extraCount) {
+    return (table->byteBudget > 0 && table->usedBytes + extraBytes > table->byteBudget) ||
+           (table->entryBudget > 0 && (size_t)table->size + extraCount > table->entryBudget);
+}
+
+/* ,     CLOCK,        extraBytes   *
+ * extraCount .  clockHand     :        *
+ *    ,   ,                   */
+void EvictPairs(TablePtrT table, size_t extraBytes, size_t extraCount) {
+    PairPtrT pair;
+    CacheInfoPtrT info;
+    size_t *link;
+    
+    while(table->size > 0 && IsOverBudget(table, extraBytes, extraCount)) {
+        if(table->clockHand >= table->pairCount) table->clockHand = 0;
+        pair = GetPair(table, table->clockHand);
+        info = GetCacheInfo(table, table->clockHand);
+        if(pair->next == DELETED_PAIR || info->referenced) {
+            info->referenced = 0;
+            table->clockHand++;
+            continue;
+        }
+        if(table->evictFunction != NULL) 
+            table->evictFunction(GetStoredKey(table, pair->key, pair->keySize, pair + 1), GetStoredValue(table, pair->value, pair + 1));
+        for(link = FindBucket(table, pair->hash); *link != table->clockHand; link = &GetPair(table, *link)->next);
+        RemovePair(table, link);
+        table->evictionCount++;
     }
-    else {
-        iter->element = iter->table->element[index];
+}
+
+/*  ,  FindOrInsertSlot,   ,     *
+ *         ,                  */
+void SettlePendingPair(TablePtrT table) {
+    PairPtrT pair;
+    CacheInfoPtrT info;
+    LSQ_BaseTypeT value;
+    
+    if(table->pendingPair == NO_PAIR) return;
+    pair = GetPair(table, table->pendingPair);
+    info = GetCacheInfo(table, table->pendingPair);
+    table->pendingPair = NO_PAIR;
+    table->usedBytes -= info->charge;
+    info->charge = pair->keySize;
+    value = GetStoredValue(table, pair->value, pair + 1);
+    if(table->vsizeFunction != NULL && value != NULL) info->charge += table->vsizeFunction(value);
+    table->usedBytes += info->charge;
+    EvictPairs(table, 0, 0);
+}
+
+/* ,    ,         ,   *
+ *                                                                                         */
+int IsFilteredOut(TablePtrT table, unsigned long long hash) {
+    if(table->bloom == NULL || TestBloomFilterHash(table->bloom, hash)) return 0;
+    table->missCount++;
+    return 1;
+}
+
+/* ,   ,      */
+void CountMiss(TablePtrT table) {
+    table->missCount++;
+    if(table->bloom != NULL) table->falsePositiveCount++;
+}
+
+/* ,          .    *
+ *                                                                                     */
+void AddToFilters(TablePtrT table, unsigned long long hash) {
+    if(table->bloom != NULL) AddBloomFilterHash(table->bloom, hash);
+    if(table->nextBloom != NULL) AddBloomFilterHash(table->nextBloom, hash);
+    else if(table->bloom != NULL && IsBloomFilterOverloaded(table->bloom)) StartFilterRebuild(table);
+}
+
+/* ,       .      *
+ *  ,  - ,   bloomCursor                                          */
+void StartFilterRebuild(TablePtrT table) {
+    SwissEntryPtrT entry = NULL;
+    size_t capacity = (size_t)(table->size > table->reservedSize ? table->size : table->reservedSize);
+    
+    table->nextBloom = CreateBloomFilter(2 * capacity, table->bloomRate);
+    table->bloomCursor = 0;
+    if(table->nextBloom == NULL) return;
+    if(table->swiss != NULL) {
+        while((entry = GetNextSwissEntry(table->swiss, entry)) != NULL)
+            AddBloomFilterHash(table->nextBloom, entry->hash);
+    }
+    RebuildFilters(table, 0);
+}
+
+/* ,     count       , *
+ *                                                                       */
+void RebuildFilters(TablePtrT table, size_t count) {
+    PairPtrT pair;
+    
+    if(table->nextBloom == NULL) return;
+    for(; count > 0 && table->bloomCursor < table->pairCount; table->bloomCursor++) {
+        pair = GetPair(table, table->bloomCursor);
+        if(pair->next == DELETED_PAIR) continue;
+        AddBloomFilterHash(table->nextBloom, pair->hash);
+        count--;
     }
+    if(table->bloomCursor < table->pairCount) return;
+    DestroyBloomFilter(table->bloom);
+    table->bloom = table->nextBloom;
+    table->nextBloom = NULL;
+    table->bloomDeletedCount = 0;
+}
+
+/* ,   ,    ,     , *
+ *                                                                    */
+void CountFilterDeletion(TablePtrT table) {
+    if(table->bloom == NULL) return;
+    table->bloomDeletedCount++;
+    if(table->nextBloom == NULL && table->bloomDeletedCount * BLOOM_DELETED_FRACTION > (size_t)table->size) StartFilterRebuild(table);
 }
 
 extern void LSQ_InsertElement(LSQ_HandleT handle, LSQ_KeyT key, LSQ_BaseTypeT value) {
     if(handle == LSQ_HandleInvalid) return;
     TablePtrT table = (TablePtrT)handle;
-    PairPtrT element = NULL;
-    IteratorPtrT iterator = LSQ_GetElementByIndex(handle, key);
+    int inserted;
+    LSQ_BaseTypeT* valueSlot = FindOrInsertSlot(table, key, 0, &inserted);
+    
+    if(valueSlot == NULL) return;
+    StoreValue(table, valueSlot, value, 0);
+    SettlePendingPair(table);
+}
+
+extern LSQ_BaseTypeT* LSQ_FindOrInsert(LSQ_HandleT handle, LSQ_KeyT key, int* inserted) {
+    if(handle == LSQ_HandleInvalid) return NULL;
+    int isInserted;
+    LSQ_BaseTypeT* valueSlot = FindOrInsertSlot((TablePtrT)handle, key, 0, &isInserted);
+    
+    if(inserted != NULL) *inserted = isInserted;
+    return valueSlot;
+}
+
+extern void LSQ_InsertElementTake(LSQ_HandleT handle, LSQ_KeyT key, LSQ_BaseTypeT value) {
+    if(handle == LSQ_HandleInvalid) return;
+    TablePtrT table = (TablePtrT)handle;
+    int inserted;
+    LSQ_BaseTypeT* valueSlot = FindOrInsertSlot(table, key, 1, &inserted);
+    
+    if(valueSlot == NULL) {
+        free(key);
+        free(value);
+        return;
+    }
+    if(!inserted) free(key);
+    StoreValue(table, valueSlot, value, 1);
+    SettlePendingPair(table);
+}
+
+extern void LSQ_DeleteElement(LSQ_HandleT handle, LSQ_KeyT key) {
+    if(handle == LSQ_HandleInvalid) return;
+    TablePtrT table = (TablePtrT)handle;
+    size_t *link;
+    SwissEntryPtrT entry;
+    SearchKeyT search;
+    
+    SettlePendingPair(table);
+    PrepareSearchKey(table, key, &search);
+    if(table->bloom != NULL && !TestBloomFilterHash(table->bloom, search.hash)) return;
+    if(table->swiss != NULL) {
+        entry = FindSwissEntry(table->swiss, search.hash, MatchSwissEntry, &search);
+        if(entry == NULL) return;
+        FreeStoredKey(table, entry->key, entry->keySize);
+        FreeStoredValue(table, entry->value);
+        DeleteSwissEntry(table->swiss, entry);
+        table->size--;
+        CountFilterDeletion(table);
+        return;
+    }
+    MigrateBuckets(table, REHASH_STEP);
+    CompactPairs(table, REHASH_STEP);
+    RebuildFilters(table, BLOOM_REBUILD_STEP);
+    link = FindPair(table, &search);
+    if(*link != NO_PAIR) RemovePair(table, link);
+}
+
+extern void LSQ_Reserve(LSQ_HandleT handle, LSQ_SizeT size) {
+    if(handle == LSQ_HandleInvalid || size < 0) return;
+    TablePtrT table = (TablePtrT)handle;
+    size_t bucketCount = GetRequiredBucketCount(size);
     
-    if(iterator != NULL && LSQ_IsIteratorDereferencable(iterator)) {
-        free(iterator->element->value);   
-        iterator->element->value = table->vcloneFunction(value);
+    if(table->swiss != NULL) {
+        if(ReserveSwissTable(table->swiss, (size_t)size)) table->reservedSize = size;
         return;
     }
+    if(bucketCount > table->bucketCount && !StartResize(table, bucketCount)) return;
+    table->reservedSize = size;
+}
+
+/* ,        keyCapacity      *
+ * valueSize      .              */
+void SetInlineStorage(TablePtrT table, size_t keyCapacity, size_t valueSize) {
+    size_t valueCapacity = (valueSize + sizeof(void*) - 1) / sizeof(void*) * sizeof(void*);
+    SwissTablePtrT swiss;
     
-    int index = CalculateHash(handle, key);
+    if(table->size != 0 || table->pairCount != 0) return;
+    if(table->swiss != NULL) {
+        swiss = CreateSwissTable(keyCapacity + valueCapacity);
+        if(swiss == NULL || !ReserveSwissTable(swiss, (size_t)table->reservedSize)) {
+            DestroySwissTable(swiss);
+            return;
+        }
+        DestroySwissTable(table->swiss);
+        table->swiss = swiss;
+    }
+    free(table->pair);
+    table->pair = NULL;
+    table->pairCapacity = 0;
+    table->pairSize = sizeof(PairT) + keyCapacity + valueCapacity + (table->isCache ? sizeof(CacheInfoT) : 0);
+    table->inlineKeyCapacity = keyCapacity;
+    table->inlineValueSize = valueSize;
+}
+
+extern void LSQ_SetInlineKeySize(LSQ_HandleT handle, LSQ_SizeT size) {
+    if(handle == LSQ_HandleInvalid || size < 0) return;
+    TablePtrT table = (TablePtrT)handle;
     
-    element = (PairPtrT)malloc(sizeof(PairT));
-    if(element == NULL) return;
+    SetInlineStorage(table, size > 0 ? ((size_t)size + sizeof(void*)) / sizeof(void*) * sizeof(void*) : 0, table->inlineValueSize);
+}
 
-    element->key = table->kcloneFunction(key);
-    element->value = table->vcloneFunction(value);
-    element->next = table->element[index];
+extern void LSQ_SetInlineValueSize(LSQ_HandleT handle, LSQ_SizeT size) {
+    if(handle == LSQ_HandleInvalid || size < 0) return;
+    TablePtrT table = (TablePtrT)handle;
     
-    table->element[index] = element;
-    table->size++;
+    SetInlineStorage(table, table->inlineKeyCapacity, (size_t)size);
 }
 
-extern void LSQ_DeleteElement(LSQ_HandleT handle, LSQ_KeyT key) {
+extern void LSQ_SetBloomFilter(LSQ_HandleT handle, double falsePositiveRate) {
     if(handle == LSQ_HandleInvalid) return;
     TablePtrT table = (TablePtrT)handle;
-    PairPtrT element = NULL, previousElement = NULL;
     
-    int index = CalculateHash(table, key);
-    element = table->element[index];
+    DestroyBloomFilter(table->bloom);
+    DestroyBloomFilter(table->nextBloom);
+    table->bloom = table->nextBloom = NULL;
+    table->bloomRate = falsePositiveRate;
+    if(falsePositiveRate <= 0.0 || falsePositiveRate >= 1.0) return;
+    StartFilterRebuild(table);
+    RebuildFilters(table, table->pairCount);
+}
+
+extern void LSQ_GetBloomFilterCounters(LSQ_HandleT handle, unsigned long long* missCount, unsigned long long* falsePositiveCount) {
+    if(handle == LSQ_HandleInvalid) return;
+    TablePtrT table = (TablePtrT)handle;
     
-    while(element != NULL && table->kcompareFunction(element->key, key)) {
-        previousElement = element;
-        element = element->next;
-    }
+    if(missCount != NULL) *missCount = table->missCount;
+    if(falsePositiveCount != NULL) *falsePositiveCount = table->falsePositiveCount;
+}
+
+extern LSQ_HandleT LSQ_CreateCache(LSQ_Callback_CloneFuncT keyCloneFunc, LSQ_Callback_SizeFuncT keySizeFunc, 
+                                   LSQ_Callback_CompareFuncT keyCompFunc, LSQ_Callback_CloneFuncT valCloneFunc,
+                                   LSQ_Callback_SizeFuncT valSizeFunc, size_t byteBudget, LSQ_SizeT entryBudget,
+                                   LSQ_Callback_EvictFuncT evictFunc)
+{
+    TablePtrT table = (TablePtrT)LSQ_CreateSequence(keyCloneFunc, keySizeFunc, keyCompFunc, valCloneFunc);
+    if(table == LSQ_HandleInvalid) return LSQ_HandleInvalid;
     
-    if(element == NULL) return;
+    table->isCache = 1;
+    table->pairSize += sizeof(CacheInfoT);
+    table->vsizeFunction = valSizeFunc;
+    table->evictFunction = evictFunc;
+    table->byteBudget = byteBudget;
+    table->entryBudget = entryBudget > 0 ? (size_t)entryBudget : 0;
+    return table;
+}
+
+extern void LSQ_GetCacheCounters(LSQ_HandleT handle, unsigned long long* hitCount, unsigned long long* missCount, 
+                                 unsigned long long* evictionCount)
+{
+    if(handle == LSQ_HandleInvalid) return;
+    TablePtrT table = (TablePtrT)handle;
     
-    if(previousElement == NULL) 
-        table->element[index] = element->next;
-    else                        
-        previousElement->next = element->next;
-        
-    free(element->key);
-    free(element->value);
-    free(element);
-    table->size--;
+    if(hitCount != NULL) *hitCount = table->hitCount;
+    if(missCount != NULL) *missCount = table->missCount;
+    if(evictionCount != NULL) *evictionCount = table->evictionCount;
 }
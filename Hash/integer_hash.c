@@ -0,0 +1,210 @@
+#include "integer_hash.h"
+#include "key_hash.h"
+#include <string.h>
+
+/*       .   -  ,    *
+ *      3/4         1/8.    *
+ *    ,                                             */
+#define INITIAL_TABLE_SIZE 16
+#define MAXIMAL_LOAD_NUMERATOR 3
+#define MAXIMAL_LOAD_DENOMINATOR 4
+#define MINIMAL_LOAD_DENOMINATOR 8
+
+/* ,   .         */
+#define EMPTY_KEY (~0ull)
+
+typedef struct IntegerEntry {
+    LSQ_IntegerKeyT key;
+    LSQ_BaseTypeT value;
+}   IntegerEntryT, *IntegerEntryPtrT;
+
+/*   -           multiplier */
+typedef struct IntegerTable {
+    IntegerEntryPtrT entry;
+    size_t capacity, size, reservedSize;
+    unsigned int shift;
+    unsigned long long multiplier;
+    int hasEmptyKey;
+    LSQ_BaseTypeT emptyKeyValue;
+}   IntegerTableT, *IntegerTablePtrT;
+
+static size_t GetHomeSlot(IntegerTablePtrT table, LSQ_IntegerKeyT key);
+static IntegerEntryPtrT FindSlot(IntegerTablePtrT table, LSQ_IntegerKeyT key);
+static size_t GetRequiredCapacity(size_t size);
+static int Resize(IntegerTablePtrT table, size_t capacity);
+static void RemoveSlot(IntegerTablePtrT table, size_t index);
+
+static size_t GetHomeSlot(IntegerTablePtrT table, LSQ_IntegerKeyT key) {
+    return (size_t)((key * table->multiplier) >> table->shift);
+}
+
+/* ,        ,     */
+static IntegerEntryPtrT FindSlot(IntegerTablePtrT table, LSQ_IntegerKeyT key) {
+    size_t index = GetHomeSlot(table, key);
+    
+    while(table->entry[index].key != key && table->entry[index].key != EMPTY_KEY)
+        index = (index + 1) & (table->capacity - 1);
+    return &table->entry[index];
+}
+
+static size_t GetRequiredCapacity(size_t size) {
+    size_t capacity = INITIAL_TABLE_SIZE;
+    
+    while(capacity * MAXIMAL_LOAD_NUMERATOR / MAXIMAL_LOAD_DENOMINATOR < size)
+        capacity *= 2;
+    return capacity;
+}
+
+static int Resize(IntegerTablePtrT table, size_t capacity) {
+    IntegerTableT old = *table;
+    size_t i;
+    
+    table->entry = (IntegerEntryPtrT)malloc(capacity * sizeof(IntegerEntryT));
+    if(table->entry == NULL) {
+        table->entry = old.entry;
+        return 0;
+    }
+    memset(table->entry, 0xff, capacity * sizeof(IntegerEntryT));
+    table->capacity = capacity;
+    table->shift = 64 - __builtin_ctzll(capacity);
+    for(i = 0; i < old.capacity; i++)
+        if(old.entry[i].key != EMPTY_KEY) *FindSlot(table, old.entry[i].key) = old.entry[i];
+    free(old.entry);
+    return 1;
+}
+
+/* ,   index. ,         , *
+ *  ,                             */
+static void RemoveSlot(IntegerTablePtrT table, size_t index) {
+    size_t mask = table->capacity - 1, next, home;
+    
+    for(next = (index + 1) & mask; table->entry[next].key != EMPTY_KEY; next = (next + 1) & mask) {
+        home = GetHomeSlot(table, table->entry[next].key);
+        if(((next - home) & mask) < ((next - index) & mask)) continue;
+        table->entry[index] = table->entry[next];
+        index = next;
+    }
+    table->entry[index].key = EMPTY_KEY;
+}
+
+extern LSQ_IntegerHashT LSQ_CreateIntegerHash(void) {
+    IntegerTablePtrT table = (IntegerTablePtrT)malloc(sizeof(IntegerTableT));
+    if(table == NULL) return LSQ_IntegerHashInvalid;
+    
+    table->entry = NULL;
+    table->capacity = table->size = table->reservedSize = 0;
+    table->multiplier = GenerateHashSeed() | 1;
+    table->hasEmptyKey = 0;
+    table->emptyKeyValue = NULL;
+    if(!Resize(table, INITIAL_TABLE_SIZE)) {
+        free(table);
+        return LSQ_IntegerHashInvalid;
+    }
+    return table;
+}
+
+extern void LSQ_DestroyIntegerHash(LSQ_IntegerHashT table) {
+    if(table == LSQ_IntegerHashInvalid) return;
+    free(((IntegerTablePtrT)table)->entry);
+    free(table);
+}
+
+extern LSQ_SizeT LSQ_IntegerHashGetSize(LSQ_IntegerHashT table) {
+    if(table == LSQ_IntegerHashInvalid) return 0;
+    return (LSQ_SizeT)(((IntegerTablePtrT)table)->size + ((IntegerTablePtrT)table)->hasEmptyKey);
+}
+
+extern LSQ_BaseTypeT* LSQ_IntegerHashFind(LSQ_IntegerHashT handle, LSQ_IntegerKeyT key) {
+    if(handle == LSQ_IntegerHashInvalid) return NULL;
+    IntegerTablePtrT table = (IntegerTablePtrT)handle;
+    IntegerEntryPtrT entry;
+    
+    if(key == EMPTY_KEY) return table->hasEmptyKey ? &table->emptyKeyValue : NULL;
+    entry = FindSlot(table, key);
+    return entry->key == key ? &entry->value : NULL;
+}
+
+extern LSQ_BaseTypeT* LSQ_IntegerHashFindOrInsert(LSQ_IntegerHashT handle, LSQ_IntegerKeyT key, int* inserted) {
+    if(handle == LSQ_IntegerHashInvalid) return NULL;
+    IntegerTablePtrT table = (IntegerTablePtrT)handle;
+    IntegerEntryPtrT entry;
+    int dummy;
+    
+    if(inserted == NULL) inserted = &dummy;
+    *inserted = 0;
+    if(key == EMPTY_KEY) {
+        if(!table->hasEmptyKey) {
+            table->hasEmptyKey = *inserted = 1;
+            table->emptyKeyValue = NULL;
+        }
+        return &table->emptyKeyValue;
+    }
+    entry = FindSlot(table, key);
+    if(entry->key == key) return &entry->value;
+    
+    if(table->size + 1 > table->capacity * MAXIMAL_LOAD_NUMERATOR / MAXIMAL_LOAD_DENOMINATOR) {
+        if(!Resize(table, table->capacity * 2)) return NULL;
+        entry = FindSlot(table, key);
+    }
+    entry->key = key;
+    entry->value = NULL;
+    table->size++;
+    *inserted = 1;
+    return &entry->value;
+}
+
+extern int LSQ_IntegerHashInsert(LSQ_IntegerHashT table, LSQ_IntegerKeyT key, LSQ_BaseTypeT value) {
+    LSQ_BaseTypeT* slot = LSQ_IntegerHashFindOrInsert(table, key, NULL);
+    
+    if(slot == NULL) return 0;
+    *slot = value;
+    return 1;
+}
+
+extern void LSQ_IntegerHashDelete(LSQ_IntegerHashT handle, LSQ_IntegerKeyT key) {
+    if(handle == LSQ_IntegerHashInvalid) return;
+    IntegerTablePtrT table = (IntegerTablePtrT)handle;
+    IntegerEntryPtrT entry;
+    
+    if(key == EMPTY_KEY) {
+        table->hasEmptyKey = 0;
+        return;
+    }
+    entry = FindSlot(table, key);
+    if(entry->key != key) return;
+    RemoveSlot(table, (size_t)(entry - table->entry));
+    table->size--;
+    
+    if(table->capacity > GetRequiredCapacity(table->reservedSize) && 
+       table->size * MINIMAL_LOAD_DENOMINATOR < table->capacity)
+        Resize(table, table->capacity / 2);
+}
+
+extern void LSQ_IntegerHashReserve(LSQ_IntegerHashT handle, LSQ_SizeT size) {
+    if(handle == LSQ_IntegerHashInvalid || size < 0) return;
+    IntegerTablePtrT table = (IntegerTablePtrT)handle;
+    size_t capacity = GetRequiredCapacity((size_t)size);
+    
+    if(capacity > table->capacity && !Resize(table, capacity)) return;
+    table->reservedSize = (size_t)size;
+}
+
+/*   0  capacity -  ,  capacity -      EMPTY_KEY */
+extern int LSQ_IntegerHashNext(LSQ_IntegerHashT handle, size_t* position, LSQ_IntegerKeyT* key, LSQ_BaseTypeT* value) {
+    if(handle == LSQ_IntegerHashInvalid || position == NULL) return 0;
+    IntegerTablePtrT table = (IntegerTablePtrT)handle;
+    
+    while(*position < table->capacity && table->entry[*position].key == EMPTY_KEY)
+        (*position)++;
+    if(*position < table->capacity) {
+        if(key != NULL) *key = table->entry[*position].key;
+        if(value != NULL) *value = table->entry[*position].value;
+        (*position)++;
+        return 1;
+    }
+    if(*position > table->capacity || !table->hasEmptyKey) return 0;
+    if(key != NULL) *key = EMPTY_KEY;
+    if(value != NULL) *value = table->emptyKeyValue;
+    (*position)++;
+    return 1;
+}
@@ -0,0 +1,45 @@
+#ifndef INTEGER_HASH_H
+#define INTEGER_HASH_H
+
+#include "linear_sequence_assoc_hash.h"
+
+/*  -   .        , *
+ *      .                */
+typedef void* LSQ_IntegerHashT;
+
+/*     */
+#define LSQ_IntegerHashInvalid NULL
+
+/*   . 32-       */
+typedef unsigned long long LSQ_IntegerKeyT;
+
+/* ,   .  LSQ_IntegerHashInvalid    */
+extern LSQ_IntegerHashT LSQ_CreateIntegerHash(void);
+/* ,  .     */
+extern void LSQ_DestroyIntegerHash(LSQ_IntegerHashT table);
+
+/* ,      */
+extern LSQ_SizeT LSQ_IntegerHashGetSize(LSQ_IntegerHashT table);
+
+/* ,          NULL,   . *
+ *                                                  */
+extern LSQ_BaseTypeT* LSQ_IntegerHashFind(LSQ_IntegerHashT table, LSQ_IntegerKeyT key);
+/* ,           NULL   .  *
+ *      NULL   ;  inserted (   NULL)  1, *
+ *   .                                   */
+extern LSQ_BaseTypeT* LSQ_IntegerHashFindOrInsert(LSQ_IntegerHashT table, LSQ_IntegerKeyT key, int* inserted);
+/* ,   -     . *
+ *  0                                                             */
+extern int LSQ_IntegerHashInsert(LSQ_IntegerHashT table, LSQ_IntegerKeyT key, LSQ_BaseTypeT value);
+/* ,      */
+extern void LSQ_IntegerHashDelete(LSQ_IntegerHashT table, LSQ_IntegerKeyT key);
+
+/* ,     size .         */
+extern void LSQ_IntegerHashReserve(LSQ_IntegerHashT table, LSQ_SizeT size);
+
+/*  :   key  value (     NULL)  ,   *
+ *  *position,     .    *position,  0,  , *
+ *    0.                                              */
+extern int LSQ_IntegerHashNext(LSQ_IntegerHashT table, size_t* position, LSQ_IntegerKeyT* key, LSQ_BaseTypeT* value);
+
+#endif
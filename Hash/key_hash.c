@@ -0,0 +1,98 @@
+#include "key_hash.h"
+#include <string.h>
+#include <time.h>
+
+/*    wyhash:    8 ,      48      *
+ *  .     64 x 64 -> 128    . */
+static const unsigned long long Secret[4] = {
+    0xa0761d6478bd642fULL, 0xe7037ed1a0b428dbULL, 0x8ebc6af09c88c6e3ULL, 0x589965cc75374cc3ULL
+};
+
+static void Multiply(unsigned long long* a, unsigned long long* b);
+static unsigned long long Mix(unsigned long long a, unsigned long long b);
+static unsigned long long Read8(const unsigned char* p);
+static unsigned long long Read4(const unsigned char* p);
+
+/* ,  a  b      128-  */
+static void Multiply(unsigned long long* a, unsigned long long* b) {
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 product = (unsigned __int128)*a * *b;
+    *a = (unsigned long long)product;
+    *b = (unsigned long long)(product >> 64);
+#else
+    unsigned long long ha = *a >> 32, hb = *b >> 32, la = (unsigned int)*a, lb = (unsigned int)*b;
+    unsigned long long hh = ha * hb, hl = ha * lb, lh = la * hb, ll = la * lb;
+    unsigned long long middle = (ll >> 32) + (unsigned int)hl + (unsigned int)lh;
+    
+    *a = (middle << 32) | (unsigned int)ll;
+    *b = hh + (hl >> 32) + (lh >> 32) + (middle >> 32);
+#endif
+}
+
+static unsigned long long Mix(unsigned long long a, unsigned long long b) {
+    Multiply(&a, &b);
+    return a ^ b;
+}
+
+static unsigned long long Read8(const unsigned char* p) {
+    unsigned long long value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static unsigned long long Read4(const unsigned char* p) {
+    unsigned int value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+extern unsigned long long HashBytes(const void* key, size_t size, unsigned long long seed) {
+    const unsigned char* p = (const unsigned char*)key;
+    unsigned long long a, b, seed1, seed2;
+    size_t i = size;
+    
+    seed ^= Mix(seed ^ Secret[0], Secret[1]);
+    if(size <= 16) {
+        if(size >= 4) {
+            a = (Read4(p) << 32) | Read4(p + ((size >> 3) << 2));
+            b = (Read4(p + size - 4) << 32) | Read4(p + size - 4 - ((size >> 3) << 2));
+        }
+        else if(size > 0) {
+            a = ((unsigned long long)p[0] << 16) | ((unsigned long long)p[size >> 1] << 8) | p[size - 1];
+            b = 0;
+        }
+        else {
+            a = b = 0;
+        }
+    }
+    else {
+        if(i > 48) {
+            seed1 = seed2 = seed;
+            do {
+                seed = Mix(Read8(p) ^ Secret[1], Read8(p + 8) ^ seed);
+                seed1 = Mix(Read8(p + 16) ^ Secret[2], Read8(p + 24) ^ seed1);
+                seed2 = Mix(Read8(p + 32) ^ Secret[3], Read8(p + 40) ^ seed2);
+                p += 48;
+                i -= 48;
+            } while(i > 48);
+            seed ^= seed1 ^ seed2;
+        }
+        for(; i > 16; i -= 16, p += 16)
+            seed = Mix(Read8(p) ^ Secret[1], Read8(p + 8) ^ seed);
+        a = Read8(p + i - 16);
+        b = Read8(p + i - 8);
+    }
+    a ^= Secret[1];
+    b ^= seed;
+    Multiply(&a, &b);
+    return Mix(a ^ Secret[0] ^ size, b ^ Secret[1]);
+}
+
+/*  seed   ,      */
+extern unsigned long long GenerateHashSeed(void) {
+    static unsigned long long counter;
+    unsigned long long local = (unsigned long long)time(NULL) ^ ((unsigned long long)clock() << 32);
+    
+    counter += Secret[2];
+    return Mix(local ^ Secret[0], ((unsigned long long)(size_t)&local) ^ counter);
+}
@@ -0,0 +1,12 @@
+#ifndef KEY_HASH_H
+#define KEY_HASH_H
+
+#include <stdlib.h>
+
+/* ,  64-  size  .   seed   , *
+ *     ,   seed,                              */
+extern unsigned long long HashBytes(const void* key, size_t size, unsigned long long seed);
+/* ,     seed    */
+extern unsigned long long GenerateHashSeed(void);
+
+#endif
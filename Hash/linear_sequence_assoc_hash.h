@@ -14,6 +14,21 @@ typedef int LSQ_SizeT;
 typedef void* LSQ_Callback_CloneFuncT (void*);
 typedef size_t LSQ_Callback_SizeFuncT (void*);
 typedef int LSQ_Callback_CompareFuncT (void*, void*);
+/*  : ,   (   )    seed . *
+ *    ,    ,          */
+typedef unsigned long long LSQ_Callback_HashFuncT (const void*, size_t, unsigned long long);
+/* ,            */
+typedef void LSQ_Callback_EvictFuncT (void*, void*);
+
+/*   . LSQ_LAYOUT_CHAINED -    ,   ,      *
+ *     . LSQ_LAYOUT_OPEN_ADDRESSING -     16      *
+ *    :     ,      ,   *
+ *     .        ,     *
+ *        :    .            */
+typedef enum {
+    LSQ_LAYOUT_CHAINED,
+    LSQ_LAYOUT_OPEN_ADDRESSING
+}   LSQ_SequenceLayoutT;
 
 /*   */
 typedef void* LSQ_HandleT;
@@ -28,6 +43,25 @@ typedef void* LSQ_IteratorT;
 /* ,   .     */
 extern LSQ_HandleT LSQ_CreateSequence(LSQ_Callback_CloneFuncT keyCloneFunc, LSQ_Callback_SizeFuncT keySizeFunc, LSQ_Callback_CompareFuncT keyCompFunc,
                                       LSQ_Callback_CloneFuncT valCloneFunc);
+/* ,        .  hashFunc,  NULL, *
+ *   64-                                                               */
+extern LSQ_HandleT LSQ_CreateSequenceWithHash(LSQ_Callback_CloneFuncT keyCloneFunc, LSQ_Callback_SizeFuncT keySizeFunc, 
+                                              LSQ_Callback_CompareFuncT keyCompFunc, LSQ_Callback_CloneFuncT valCloneFunc,
+                                              LSQ_Callback_HashFuncT hashFunc);
+/* ,        ( NULL)    */
+extern LSQ_HandleT LSQ_CreateSequenceWithLayout(LSQ_Callback_CloneFuncT keyCloneFunc, LSQ_Callback_SizeFuncT keySizeFunc, 
+                                                LSQ_Callback_CompareFuncT keyCompFunc, LSQ_Callback_CloneFuncT valCloneFunc,
+                                                LSQ_Callback_HashFuncT hashFunc, LSQ_SequenceLayoutT layout);
+/* ,   :   ,      ( keySizeFunc)      *
+ *  ( valSizeFunc,    NULL)   byteBudget ,    - entryBudget.   *
+ *    .       CLOCK:      *
+ * ,        ,      evictFunc     *
+ * (   NULL).  ,   LSQ_FindOrInsert,            *
+ *                                                                                         */
+extern LSQ_HandleT LSQ_CreateCache(LSQ_Callback_CloneFuncT keyCloneFunc, LSQ_Callback_SizeFuncT keySizeFunc, 
+                                   LSQ_Callback_CompareFuncT keyCompFunc, LSQ_Callback_CloneFuncT valCloneFunc,
+                                   LSQ_Callback_SizeFuncT valSizeFunc, size_t byteBudget, LSQ_SizeT entryBudget,
+                                   LSQ_Callback_EvictFuncT evictFunc);
 /* ,     .     */
 extern void LSQ_DestroySequence(LSQ_HandleT handle);
 
@@ -50,12 +84,18 @@ extern LSQ_KeyT LSQ_GetIteratorKey(LSQ_IteratorT iterator);
 /* ,  ,      .       *
  *   ,     PastRear.                                       */
 extern LSQ_IteratorT LSQ_GetElementByIndex(LSQ_HandleT handle, LSQ_KeyT key);
+/* ,   results[i]     keys[i]  NULL,    , *
+ *   i  0  count.      ,   ,      */
+extern void LSQ_GetElementsBatch(LSQ_HandleT handle, const LSQ_KeyT* keys, size_t count, LSQ_BaseTypeT* results);
 /* ,  ,      */
 extern LSQ_IteratorT LSQ_GetFrontElement(LSQ_HandleT handle);
 /* ,  ,    ,      */
 extern LSQ_IteratorT LSQ_GetPastRearElement(LSQ_HandleT handle);
 
-/* ,           */
+/* ,          .    *
+ *     ,    ,    .     *
+ *      , ,   ,             *
+ *     ,                              */
 extern void LSQ_DestroyIterator(LSQ_IteratorT iterator);
 
 /*       .       *
@@ -66,8 +106,50 @@ extern void LSQ_AdvanceOneElement(LSQ_IteratorT iterator);
 /* ,    -  .      ,  *
  *    .                                                                  */
 extern void LSQ_InsertElement(LSQ_HandleT handle, LSQ_KeyT key, LSQ_BaseTypeT value);
+/* ,           .    *
+ *  ,    ,  malloc:    .  *
+ *   ,    NULL,   inserted (   NULL)  1.   *
+ *    (LSQ_SetInlineValueSize)      :   *
+ *  ,    - ,       .                                  *
+ *      .  NULL           */
+extern LSQ_BaseTypeT* LSQ_FindOrInsert(LSQ_HandleT handle, LSQ_KeyT key, int* inserted);
+/* ,    :    malloc key  value.   *
+ *    ,   ,   key                        */
+extern void LSQ_InsertElementTake(LSQ_HandleT handle, LSQ_KeyT key, LSQ_BaseTypeT value);
 
 /* ,   ,   . */
 extern void LSQ_DeleteElement(LSQ_HandleT handle, LSQ_KeyT key);
 
+/* ,     size ,       . *
+ *         .                     */
+extern void LSQ_Reserve(LSQ_HandleT handle, LSQ_SizeT size);
+
+/* ,     ( keySizeFunc)   size    ,   *
+ * keyCloneFunc  keyCompFunc:      ,      *
+ * ,     . ,       .   *
+ *  LSQ_GetIteratorKey       .  *
+ *    , 0 ( )                                        */
+extern void LSQ_SetInlineKeySize(LSQ_HandleT handle, LSQ_SizeT size);
+
+/* ,      : value  LSQ_InsertElement   size , *
+ *    valCloneFunc     ,  LSQ_DereferenceIterator          *
+ * LSQ_GetElementsBatch      ,        *
+ * . LSQ_InsertElementTake      .     *
+ *  , 0 ( )                                                   */
+extern void LSQ_SetInlineValueSize(LSQ_HandleT handle, LSQ_SizeT size);
+
+/* ,     :        *
+ *    ,   falsePositiveRate     .        *
+ *  1.6 * log2(1 / falsePositiveRate)   ,          *
+ *       .    0                */
+extern void LSQ_SetBloomFilter(LSQ_HandleT handle, double falsePositiveRate);
+/* ,          ,    , *
+ *     .      NULL                             */
+extern void LSQ_GetBloomFilterCounters(LSQ_HandleT handle, unsigned long long* missCount, unsigned long long* falsePositiveCount);
+
+/* ,            . *
+ *      NULL                                                             */
+extern void LSQ_GetCacheCounters(LSQ_HandleT handle, unsigned long long* hitCount, unsigned long long* missCount, 
+                                 unsigned long long* evictionCount);
+
 #endif
@@ -0,0 +1,239 @@
+#include "swiss_table.h"
+#include <string.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define GROUP_SIZE 16
+#define CONTROL_EMPTY 0x80
+#define OVERFLOW_SATURATED 255
+/*      7/8        1/8 */
+#define MAXIMAL_LOAD_NUMERATOR 7
+#define MAXIMAL_LOAD_DENOMINATOR 8
+#define MINIMAL_LOAD_DENOMINATOR 8
+
+/*    entrySize : SwissEntryT          */
+struct SwissTable {
+    unsigned char* control;
+    unsigned char* overflow;
+    unsigned char* entry;
+    size_t entrySize, groupCount, size, reservedSize;
+};
+
+static SwissEntryPtrT GetEntry(SwissTablePtrT table, size_t index);
+static unsigned int MatchByte(const unsigned char* control, unsigned char value);
+static unsigned int MatchEmpty(const unsigned char* control);
+static size_t GetHomeGroup(SwissTablePtrT table, unsigned long long hash);
+static unsigned char GetControlByte(unsigned long long hash);
+static size_t GetCapacity(size_t groupCount);
+static SwissEntryPtrT ClaimSlot(SwissTablePtrT table, unsigned long long hash, size_t group, size_t step, unsigned int empty);
+static SwissEntryPtrT PlaceEntry(SwissTablePtrT table, unsigned long long hash);
+static int Resize(SwissTablePtrT table, size_t groupCount);
+
+static SwissEntryPtrT GetEntry(SwissTablePtrT table, size_t index) {
+    return (SwissEntryPtrT)(table->entry + index * table->entrySize);
+}
+
+/* ,    ,     value */
+static unsigned int MatchByte(const unsigned char* control, unsigned char value) {
+#ifdef __SSE2__
+    __m128i group = _mm_loadu_si128((const __m128i*)control);
+    return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)value)));
+#else
+    unsigned int mask = 0;
+    int i;
+    
+    for(i = 0; i < GROUP_SIZE; i++)
+        if(control[i] == value) mask |= 1u << i;
+    return mask;
+#endif
+}
+
+/* ,     :   ,    ,    1 */
+static unsigned int MatchEmpty(const unsigned char* control) {
+#ifdef __SSE2__
+    return (unsigned int)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)control));
+#else
+    return MatchByte(control, CONTROL_EMPTY);
+#endif
+}
+
+/*        ,   -   */
+static size_t GetHomeGroup(SwissTablePtrT table, unsigned long long hash) {
+    return (size_t)(hash >> 32) & (table->groupCount - 1);
+}
+
+static unsigned char GetControlByte(unsigned long long hash) {
+    return (unsigned char)(hash & 0x7f);
+}
+
+static size_t GetCapacity(size_t groupCount) {
+    return groupCount * GROUP_SIZE * MAXIMAL_LOAD_NUMERATOR / MAXIMAL_LOAD_DENOMINATOR;
+}
+
+/* ,     empty  group,       step . *
+ *  ,   ,                                              */
+static SwissEntryPtrT ClaimSlot(SwissTablePtrT table, unsigned long long hash, size_t group, size_t step, unsigned int empty) {
+    size_t passed = GetHomeGroup(table, hash), i, index = group * GROUP_SIZE + __builtin_ctz(empty);
+    
+    for(i = 0; i < step; passed = (passed + ++i) & (table->groupCount - 1))
+        if(table->overflow[passed] < OVERFLOW_SATURATED) table->overflow[passed]++;
+    table->control[index] = GetControlByte(hash);
+    GetEntry(table, index)->hash = hash;
+    table->size++;
+    return GetEntry(table, index);
+}
+
+/* ,       .     1, 2, 3, ...   *
+ *                                                                            */
+static SwissEntryPtrT PlaceEntry(SwissTablePtrT table, unsigned long long hash) {
+    size_t group = GetHomeGroup(table, hash), step = 0;
+    unsigned int empty;
+    
+    while((empty = MatchEmpty(table->control + group * GROUP_SIZE)) == 0)
+        group = (group + ++step) & (table->groupCount - 1);
+    return ClaimSlot(table, hash, group, step, empty);
+}
+
+/* ,    groupCount .      */
+static int Resize(SwissTablePtrT table, size_t groupCount) {
+    SwissTableT old = *table;
+    SwissEntryPtrT entry;
+    size_t i;
+    
+    table->control = (unsigned char*)malloc(groupCount * GROUP_SIZE);
+    table->overflow = (unsigned char*)calloc(groupCount, 1);
+    table->entry = (unsigned char*)malloc(table->entrySize * groupCount * GROUP_SIZE);
+    if(table->control == NULL || table->overflow == NULL || table->entry == NULL) {
+        free(table->control);
+        free(table->overflow);
+        free(table->entry);
+        *table = old;
+        return 0;
+    }
+    memset(table->control, CONTROL_EMPTY, groupCount * GROUP_SIZE);
+    table->groupCount = groupCount;
+    table->size = 0;
+    for(i = 0; i < old.groupCount * GROUP_SIZE; i++) {
+        if(old.control[i] & CONTROL_EMPTY) continue;
+        entry = PlaceEntry(table, GetEntry(&old, i)->hash);
+        memcpy(entry, GetEntry(&old, i), table->entrySize);
+    }
+    free(old.control);
+    free(old.overflow);
+    free(old.entry);
+    return 1;
+}
+
+extern SwissTablePtrT CreateSwissTable(size_t extraSize) {
+    SwissTablePtrT table = (SwissTablePtrT)malloc(sizeof(SwissTableT));
+    if(table == NULL) return NULL;
+    
+    table->control = table->overflow = table->entry = NULL;
+    table->entrySize = (sizeof(SwissEntryT) + extraSize + sizeof(void*) - 1) / sizeof(void*) * sizeof(void*);
+    table->groupCount = table->size = table->reservedSize = 0;
+    if(!Resize(table, 1)) {
+        free(table);
+        return NULL;
+    }
+    return table;
+}
+
+extern void DestroySwissTable(SwissTablePtrT table) {
+    if(table == NULL) return;
+    free(table->control);
+    free(table->overflow);
+    free(table->entry);
+    free(table);
+}
+
+extern SwissEntryPtrT FindSwissEntry(SwissTablePtrT table, unsigned long long hash, SwissMatchFuncT* match, const void* context) {
+    size_t group = GetHomeGroup(table, hash), step = 0;
+    unsigned int mask;
+    SwissEntryPtrT entry;
+    
+    for(;;) {
+        mask = MatchByte(table->control + group * GROUP_SIZE, GetControlByte(hash));
+        for(; mask != 0; mask &= mask - 1) {
+            entry = GetEntry(table, group * GROUP_SIZE + __builtin_ctz(mask));
+            if(entry->hash == hash && match(context, entry)) return entry;
+        }
+        if(table->overflow[group] == 0 || step == table->groupCount) return NULL;
+        group = (group + ++step) & (table->groupCount - 1);
+    }
+}
+
+extern void PrefetchSwissEntry(SwissTablePtrT table, unsigned long long hash) {
+    size_t group = GetHomeGroup(table, hash);
+    
+    __builtin_prefetch(table->control + group * GROUP_SIZE);
+    __builtin_prefetch(GetEntry(table, group * GROUP_SIZE));
+}
+
+/*       .    ,   ,    *
+ *      ,                                                    */
+extern SwissEntryPtrT FindOrInsertSwissEntry(SwissTablePtrT table, unsigned long long hash, SwissMatchFuncT* match, 
+                                             const void* context, int* inserted) {
+    size_t group, step = 0, target = 0, targetStep = 0;
+    unsigned int mask, empty = 0;
+    SwissEntryPtrT entry;
+    
+    *inserted = 0;
+    if(table->size + 1 > GetCapacity(table->groupCount) && !Resize(table, table->groupCount * 2)) 
+        return FindSwissEntry(table, hash, match, context);
+    group = GetHomeGroup(table, hash);
+    for(;;) {
+        mask = MatchByte(table->control + group * GROUP_SIZE, GetControlByte(hash));
+        for(; mask != 0; mask &= mask - 1) {
+            entry = GetEntry(table, group * GROUP_SIZE + __builtin_ctz(mask));
+            if(entry->hash == hash && match(context, entry)) return entry;
+        }
+        if(empty == 0 && (empty = MatchEmpty(table->control + group * GROUP_SIZE)) != 0) {
+            target = group;
+            targetStep = step;
+        }
+        if(table->overflow[group] == 0 || step == table->groupCount) break;
+        group = (group + ++step) & (table->groupCount - 1);
+    }
+    while(empty == 0) {
+        group = (group + ++step) & (table->groupCount - 1);
+        if((empty = MatchEmpty(table->control + group * GROUP_SIZE)) != 0) {
+            target = group;
+            targetStep = step;
+        }
+    }
+    *inserted = 1;
+    return ClaimSlot(table, hash, target, targetStep, empty);
+}
+
+/*     ,    :        */
+extern void DeleteSwissEntry(SwissTablePtrT table, SwissEntryPtrT entry) {
+    size_t index = (size_t)((unsigned char*)entry - table->entry) / table->entrySize, target = index / GROUP_SIZE;
+    size_t group = GetHomeGroup(table, entry->hash), step = 0;
+    
+    for(; group != target; group = (group + ++step) & (table->groupCount - 1))
+        if(table->overflow[group] < OVERFLOW_SATURATED) table->overflow[group]--;
+    table->control[index] = CONTROL_EMPTY;
+    table->size--;
+    if(table->groupCount > 1 && table->size * MINIMAL_LOAD_DENOMINATOR < GetCapacity(table->groupCount) &&
+       GetCapacity(table->groupCount / 2) >= table->reservedSize)
+        Resize(table, table->groupCount / 2);
+}
+
+extern SwissEntryPtrT GetNextSwissEntry(SwissTablePtrT table, SwissEntryPtrT entry) {
+    size_t index = entry == NULL ? 0 : (size_t)((unsigned char*)entry - table->entry) / table->entrySize + 1;
+    
+    for(; index < table->groupCount * GROUP_SIZE; index++)
+        if(!(table->control[index] & CONTROL_EMPTY)) return GetEntry(table, index);
+    return NULL;
+}
+
+extern int ReserveSwissTable(SwissTablePtrT table, size_t size) {
+    size_t groupCount = table->groupCount;
+    
+    while(GetCapacity(groupCount) < size)
+        groupCount *= 2;
+    if(groupCount > table->groupCount && !Resize(table, groupCount)) return 0;
+    table->reservedSize = size;
+    return 1;
+}
@@ -0,0 +1,45 @@
+#ifndef SWISS_TABLE_H
+#define SWISS_TABLE_H
+
+#include "linear_sequence_assoc_hash.h"
+
+/*    :     ,     16.    *
+ *    - 7      ,       *
+ * 16 .       ,     ,       *
+ * .     ,    ,        *
+ *         .                                                         */
+typedef struct SwissTable SwissTableT, *SwissTablePtrT;
+
+/*  key, value  keySize      */
+typedef struct SwissEntry {
+    LSQ_KeyT key;
+    LSQ_BaseTypeT value;
+    unsigned long long hash;
+    size_t keySize;
+}   SwissEntryT, *SwissEntryPtrT;
+
+/* , ,        ,  context */
+typedef int SwissMatchFuncT (const void* context, SwissEntryPtrT entry);
+
+/* ,   .     extraSize     */
+extern SwissTablePtrT CreateSwissTable(size_t extraSize);
+/* ,  .       */
+extern void DestroySwissTable(SwissTablePtrT table);
+
+/* ,     ,   match   ,  NULL */
+extern SwissEntryPtrT FindSwissEntry(SwissTablePtrT table, unsigned long long hash, SwissMatchFuncT* match, const void* context);
+/* ,            */
+extern void PrefetchSwissEntry(SwissTablePtrT table, unsigned long long hash);
+/* ,  ,  FindSwissEntry,     -        *
+ *    1  inserted.        .          *
+ *  NULL                                                                       */
+extern SwissEntryPtrT FindOrInsertSwissEntry(SwissTablePtrT table, unsigned long long hash, SwissMatchFuncT* match, 
+                                             const void* context, int* inserted);
+/* ,   .       */
+extern void DeleteSwissEntry(SwissTablePtrT table, SwissEntryPtrT entry);
+/* ,  ,      (  entry,  NULL),  NULL */
+extern SwissEntryPtrT GetNextSwissEntry(SwissTablePtrT table, SwissEntryPtrT entry);
+/* ,     size .  0    */
+extern int ReserveSwissTable(SwissTablePtrT table, size_t size);
+
+#endif
@@ -0,0 +1,213 @@
+#include "concurrent_queue.h"
+#include <stdatomic.h>
+
+/*  -:      ,      *
+ *  CAS.      : ,  ,    *
+ *    ,      ,       .  *
+ *      ,        .   */
+#define CACHE_LINE_SIZE 64
+#define HAZARD_SLOT_COUNT 128
+#define HAZARDS_PER_SLOT 2
+#define RETIRE_THRESHOLD (2 * HAZARD_SLOT_COUNT * HAZARDS_PER_SLOT)
+
+typedef struct QueueNode {
+    LSQ_BaseTypeT data;
+    _Atomic(struct QueueNode*) nextNode;
+    struct QueueNode* nextRetired;
+}   QueueNodeT, *QueueNodePtrT;
+
+typedef struct {
+    _Alignas(CACHE_LINE_SIZE) _Atomic(QueueNodePtrT) hazard[HAZARDS_PER_SLOT];
+    atomic_int busy;
+    QueueNodePtrT retired;
+    int retiredCount;
+}   HazardSlotT, *HazardSlotPtrT;
+
+typedef struct {
+    _Alignas(CACHE_LINE_SIZE) _Atomic(QueueNodePtrT) head;
+    _Alignas(CACHE_LINE_SIZE) _Atomic(QueueNodePtrT) tail;
+    HazardSlotPtrT slots;
+}   ConcurrentQueueT, *ConcurrentQueuePtrT;
+
+/*  ,       . 0 -     */
+static _Thread_local unsigned int threadNumber;
+static atomic_uint nextThreadNumber = 1;
+
+static HazardSlotPtrT AcquireSlot(ConcurrentQueuePtrT);
+static void ReleaseSlot(HazardSlotPtrT);
+static QueueNodePtrT Protect(HazardSlotPtrT, int, _Atomic(QueueNodePtrT)*);
+static void RetireNode(ConcurrentQueuePtrT, HazardSlotPtrT, QueueNodePtrT);
+static void Reclaim(ConcurrentQueuePtrT, HazardSlotPtrT);
+
+/* ,    .          *
+ *                                                                                      */
+static HazardSlotPtrT AcquireSlot(ConcurrentQueuePtrT queue) {
+    unsigned int i;
+    int expected;
+    
+    if(threadNumber == 0)
+        threadNumber = atomic_fetch_add(&nextThreadNumber, 1);
+    for(i = threadNumber;; i++) {
+        expected = 0;
+        if(atomic_load_explicit(&queue->slots[i % HAZARD_SLOT_COUNT].busy, memory_order_relaxed) == 0 &&
+           atomic_compare_exchange_strong(&queue->slots[i % HAZARD_SLOT_COUNT].busy, &expected, 1))
+            return &queue->slots[i % HAZARD_SLOT_COUNT];
+    }
+}
+
+static void ReleaseSlot(HazardSlotPtrT slot) {
+    int i;
+    
+    for(i = 0; i < HAZARDS_PER_SLOT; i++)
+        atomic_store_explicit(&slot->hazard[i], NULL, memory_order_release);
+    atomic_store_explicit(&slot->busy, 0, memory_order_release);
+}
+
+/* ,       .  ,     *
+ *   :                                */
+static QueueNodePtrT Protect(HazardSlotPtrT slot, int index, _Atomic(QueueNodePtrT)* source) {
+    QueueNodePtrT node = atomic_load(source), check;
+    
+    for(;;) {
+        atomic_store(&slot->hazard[index], node);
+        check = atomic_load(source);
+        if(check == node) return node;
+        node = check;
+    }
+}
+
+static void RetireNode(ConcurrentQueuePtrT queue, HazardSlotPtrT slot, QueueNodePtrT node) {
+    node->nextRetired = slot->retired;
+    slot->retired = node;
+    if(++slot->retiredCount >= RETIRE_THRESHOLD)
+        Reclaim(queue, slot);
+}
+
+/* ,   ,       */
+static void Reclaim(ConcurrentQueuePtrT queue, HazardSlotPtrT slot) {
+    QueueNodePtrT node = slot->retired, next;
+    int i, j, hazardous;
+    
+    slot->retired = NULL;
+    slot->retiredCount = 0;
+    for(; node != NULL; node = next) {
+        next = node->nextRetired;
+        hazardous = 0;
+        for(i = 0; i < HAZARD_SLOT_COUNT && !hazardous; i++) {
+            for(j = 0; j < HAZARDS_PER_SLOT; j++)
+                if(atomic_load(&queue->slots[i].hazard[j]) == node) hazardous = 1;
+        }
+        if(hazardous) {
+            node->nextRetired = slot->retired;
+            slot->retired = node;
+            slot->retiredCount++;
+        }
+        else {
+            free(node);
+        }
+    }
+}
+
+extern LSQ_ConcurrentQueueT LSQ_CreateConcurrentQueue(void) {
+    ConcurrentQueuePtrT queue = (ConcurrentQueuePtrT)aligned_alloc(CACHE_LINE_SIZE, sizeof(ConcurrentQueueT));
+    QueueNodePtrT dummy = (QueueNodePtrT)malloc(sizeof(QueueNodeT));
+    int i, j;
+    
+    if(queue != NULL)
+        queue->slots = (HazardSlotPtrT)aligned_alloc(CACHE_LINE_SIZE, sizeof(HazardSlotT) * HAZARD_SLOT_COUNT);
+    if(queue == NULL || dummy == NULL || queue->slots == NULL) {
+        if(queue != NULL) free(queue->slots);
+        free(queue);
+        free(dummy);
+        return LSQ_ConcurrentQueueInvalid;
+    }
+    for(i = 0; i < HAZARD_SLOT_COUNT; i++) {
+        for(j = 0; j < HAZARDS_PER_SLOT; j++)
+            atomic_init(&queue->slots[i].hazard[j], NULL);
+        atomic_init(&queue->slots[i].busy, 0);
+        queue->slots[i].retired = NULL;
+        queue->slots[i].retiredCount = 0;
+    }
+    atomic_init(&dummy->nextNode, NULL);
+    atomic_init(&queue->head, dummy);
+    atomic_init(&queue->tail, dummy);
+    return queue;
+}
+
+extern void LSQ_DestroyConcurrentQueue(LSQ_ConcurrentQueueT queue) {
+    ConcurrentQueuePtrT pointer = (ConcurrentQueuePtrT)queue;
+    QueueNodePtrT node, next;
+    int i;
+    
+    if(pointer == LSQ_ConcurrentQueueInvalid) return;
+    for(node = atomic_load(&pointer->head); node != NULL; node = next) {
+        next = atomic_load(&node->nextNode);
+        free(node);
+    }
+    for(i = 0; i < HAZARD_SLOT_COUNT; i++) {
+        for(node = pointer->slots[i].retired; node != NULL; node = next) {
+            next = node->nextRetired;
+            free(node);
+        }
+    }
+    free(pointer->slots);
+    free(pointer);
+}
+
+extern int LSQ_ConcurrentPushRear(LSQ_ConcurrentQueueT queue, LSQ_BaseTypeT element) {
+    ConcurrentQueuePtrT pointer = (ConcurrentQueuePtrT)queue;
+    QueueNodePtrT node, tail, next;
+    HazardSlotPtrT slot;
+    
+    if(pointer == LSQ_ConcurrentQueueInvalid) return 0;
+    node = (QueueNodePtrT)malloc(sizeof(QueueNodeT));
+    if(node == NULL) return 0;
+    node->data = element;
+    atomic_init(&node->nextNode, NULL);
+    
+    slot = AcquireSlot(pointer);
+    for(;;) {
+        tail = Protect(slot, 0, &pointer->tail);
+        next = atomic_load(&tail->nextNode);
+        if(tail != atomic_load(&pointer->tail)) continue;
+        if(next != NULL) {
+            atomic_compare_exchange_weak(&pointer->tail, &tail, next);
+            continue;
+        }
+        if(atomic_compare_exchange_weak(&tail->nextNode, &next, node)) {
+            atomic_compare_exchange_strong(&pointer->tail, &tail, node);
+            break;
+        }
+    }
+    ReleaseSlot(slot);
+    return 1;
+}
+
+extern int LSQ_ConcurrentPopFront(LSQ_ConcurrentQueueT queue, LSQ_BaseTypeT* element) {
+    ConcurrentQueuePtrT pointer = (ConcurrentQueuePtrT)queue;
+    QueueNodePtrT head, tail, next;
+    HazardSlotPtrT slot;
+    int result = 0;
+    
+    if(pointer == LSQ_ConcurrentQueueInvalid || element == NULL) return 0;
+    slot = AcquireSlot(pointer);
+    for(;;) {
+        head = Protect(slot, 0, &pointer->head);
+        tail = atomic_load(&pointer->tail);
+        next = Protect(slot, 1, &head->nextNode);
+        if(head != atomic_load(&pointer->head)) continue;
+        if(next == NULL) break;
+        if(head == tail) {
+            atomic_compare_exchange_weak(&pointer->tail, &tail, next);
+            continue;
+        }
+        *element = next->data;
+        if(atomic_compare_exchange_weak(&pointer->head, &head, next)) {
+            RetireNode(pointer, slot, head);
+            result = 1;
+            break;
+        }
+    }
+    ReleaseSlot(slot);
+    return result;
+}
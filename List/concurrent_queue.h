@@ -0,0 +1,24 @@
+#ifndef CONCURRENT_QUEUE_H
+#define CONCURRENT_QUEUE_H
+
+#include "linear_sequence.h"
+
+/*  ,        */
+typedef void* LSQ_ConcurrentQueueT;
+
+/*     */
+#define LSQ_ConcurrentQueueInvalid NULL
+
+/* ,   .     */
+extern LSQ_ConcurrentQueueT LSQ_CreateConcurrentQueue(void);
+/* ,  . ,          */
+extern void LSQ_DestroyConcurrentQueue(LSQ_ConcurrentQueueT queue);
+
+/* ,     .      . *
+ *  0                                                                     */
+extern int LSQ_ConcurrentPushRear(LSQ_ConcurrentQueueT queue, LSQ_BaseTypeT element);
+/* ,       *element.      *
+ * .  0,                                                       */
+extern int LSQ_ConcurrentPopFront(LSQ_ConcurrentQueueT queue, LSQ_BaseTypeT* element);
+
+#endif
@@ -0,0 +1,184 @@
+#include "intrusive_list.h"
+
+typedef struct {
+    LSQ_IntegerIndexT size;
+    size_t linkOffset;
+    LSQ_IntrusiveLinkT beforeFirst, pastRear;
+}   IntrusiveListT, *IntrusiveListPtrT;
+
+typedef struct {
+    IntrusiveListPtrT handle;
+    LSQ_IntrusiveLinkT* link;
+}   IntrusiveIteratorT, *IntrusiveIteratorPtrT;
+
+static LSQ_IntrusiveLinkT* GetLink(IntrusiveListPtrT, void*);
+static IntrusiveIteratorPtrT CreateIterator(IntrusiveListPtrT, LSQ_IntrusiveLinkT*);
+static void LinkBefore(IntrusiveListPtrT, LSQ_IntrusiveLinkT*, LSQ_IntrusiveLinkT*);
+static void Unlink(IntrusiveListPtrT, LSQ_IntrusiveLinkT*);
+
+static LSQ_IntrusiveLinkT* GetLink(IntrusiveListPtrT list, void* object) {
+    return (LSQ_IntrusiveLinkT*)((char*)object + list->linkOffset);
+}
+
+static IntrusiveIteratorPtrT CreateIterator(IntrusiveListPtrT list, LSQ_IntrusiveLinkT* link) {
+    IntrusiveIteratorPtrT iterator = (IntrusiveIteratorPtrT)malloc(sizeof(IntrusiveIteratorT));
+    if(iterator == NULL) return NULL;
+    iterator->handle = list;
+    iterator->link = link;
+    return iterator;
+}
+
+/* ,   link   position */
+static void LinkBefore(IntrusiveListPtrT list, LSQ_IntrusiveLinkT* position, LSQ_IntrusiveLinkT* link) {
+    link->nextLink = position;
+    link->previousLink = position->previousLink;
+    position->previousLink->nextLink = link;
+    position->previousLink = link;
+    list->size++;
+}
+
+static void Unlink(IntrusiveListPtrT list, LSQ_IntrusiveLinkT* link) {
+    link->previousLink->nextLink = link->nextLink;
+    link->nextLink->previousLink = link->previousLink;
+    link->nextLink = link->previousLink = NULL;
+    list->size--;
+}
+
+extern LSQ_HandleT LSQ_CreateIntrusiveSequence(size_t linkOffset) {
+    IntrusiveListPtrT list = (IntrusiveListPtrT)malloc(sizeof(IntrusiveListT));
+    if(list == NULL) return LSQ_HandleInvalid;
+    
+    list->size = 0;
+    list->linkOffset = linkOffset;
+    list->beforeFirst.nextLink = &list->pastRear;
+    list->beforeFirst.previousLink = NULL;
+    list->pastRear.nextLink = NULL;
+    list->pastRear.previousLink = &list->beforeFirst;
+    return list;
+}
+
+extern void LSQ_DestroyIntrusiveSequence(LSQ_HandleT handle) {
+    free(handle);
+}
+
+extern LSQ_IntegerIndexT LSQ_GetIntrusiveSize(LSQ_HandleT handle) {
+    if(handle == LSQ_HandleInvalid) return -1;
+    return ((IntrusiveListPtrT)handle)->size;
+}
+
+extern int LSQ_IsIntrusiveIteratorDereferencable(LSQ_IteratorT iterator) {
+    if(iterator == NULL) return 0;
+    return !LSQ_IsIntrusiveIteratorPastRear(iterator) && !LSQ_IsIntrusiveIteratorBeforeFirst(iterator);
+}
+
+extern int LSQ_IsIntrusiveIteratorPastRear(LSQ_IteratorT iterator) {
+    if(iterator == NULL) return 0;
+    return ((IntrusiveIteratorPtrT)iterator)->link == &((IntrusiveIteratorPtrT)iterator)->handle->pastRear;
+}
+
+extern int LSQ_IsIntrusiveIteratorBeforeFirst(LSQ_IteratorT iterator) {
+    if(iterator == NULL) return 0;
+    return ((IntrusiveIteratorPtrT)iterator)->link == &((IntrusiveIteratorPtrT)iterator)->handle->beforeFirst;
+}
+
+extern void* LSQ_DereferenceIntrusiveIterator(LSQ_IteratorT iterator) {
+    IntrusiveIteratorPtrT iter = (IntrusiveIteratorPtrT)iterator;
+    if(!LSQ_IsIntrusiveIteratorDereferencable(iter)) return NULL;
+    return (char*)iter->link - iter->handle->linkOffset;
+}
+
+extern LSQ_IteratorT LSQ_GetIntrusiveElementByIndex(LSQ_HandleT handle, LSQ_IntegerIndexT index) {
+    LSQ_IteratorT iterator = LSQ_GetIntrusiveFrontElement(handle);
+    LSQ_ShiftIntrusivePosition(iterator, index);
+    return iterator;
+}
+
+extern LSQ_IteratorT LSQ_GetIntrusiveFrontElement(LSQ_HandleT handle) {
+    if(handle == LSQ_HandleInvalid) return NULL;
+    return CreateIterator((IntrusiveListPtrT)handle, ((IntrusiveListPtrT)handle)->beforeFirst.nextLink);
+}
+
+extern LSQ_IteratorT LSQ_GetIntrusivePastRearElement(LSQ_HandleT handle) {
+    if(handle == LSQ_HandleInvalid) return NULL;
+    return CreateIterator((IntrusiveListPtrT)handle, &((IntrusiveListPtrT)handle)->pastRear);
+}
+
+extern LSQ_IteratorT LSQ_GetIntrusiveIteratorOf(LSQ_HandleT handle, void* object) {
+    if(handle == LSQ_HandleInvalid || object == NULL) return NULL;
+    return CreateIterator((IntrusiveListPtrT)handle, GetLink((IntrusiveListPtrT)handle, object));
+}
+
+extern void LSQ_DestroyIntrusiveIterator(LSQ_IteratorT iterator) {
+    free(iterator);
+}
+
+extern void LSQ_AdvanceOneIntrusiveElement(LSQ_IteratorT iterator) {
+    LSQ_ShiftIntrusivePosition(iterator, 1);
+}
+
+extern void LSQ_RewindOneIntrusiveElement(LSQ_IteratorT iterator) {
+    LSQ_ShiftIntrusivePosition(iterator, -1);
+}
+
+extern void LSQ_ShiftIntrusivePosition(LSQ_IteratorT iterator, LSQ_IntegerIndexT shift) {
+    IntrusiveIteratorPtrT iter = (IntrusiveIteratorPtrT)iterator;
+    if(iter == NULL) return;
+    
+    for(; shift > 0 && iter->link->nextLink != NULL; shift--)
+        iter->link = iter->link->nextLink;
+    for(; shift < 0 && iter->link->previousLink != NULL; shift++)
+        iter->link = iter->link->previousLink;
+}
+
+extern void LSQ_SetIntrusivePosition(LSQ_IteratorT iterator, LSQ_IntegerIndexT pos) {
+    IntrusiveIteratorPtrT iter = (IntrusiveIteratorPtrT)iterator;
+    if(iter == NULL) return;
+    
+    iter->link = &iter->handle->beforeFirst;
+    LSQ_ShiftIntrusivePosition(iter, pos < 0 ? 0 : pos + 1);
+}
+
+extern void LSQ_InsertIntrusiveFrontElement(LSQ_HandleT handle, void* object) {
+    if(handle == LSQ_HandleInvalid || object == NULL) return;
+    LinkBefore((IntrusiveListPtrT)handle, ((IntrusiveListPtrT)handle)->beforeFirst.nextLink, GetLink((IntrusiveListPtrT)handle, object));
+}
+
+extern void LSQ_InsertIntrusiveRearElement(LSQ_HandleT handle, void* object) {
+    if(handle == LSQ_HandleInvalid || object == NULL) return;
+    LinkBefore((IntrusiveListPtrT)handle, &((IntrusiveListPtrT)handle)->pastRear, GetLink((IntrusiveListPtrT)handle, object));
+}
+
+extern void LSQ_InsertIntrusiveElementBeforeGiven(LSQ_IteratorT iterator, void* object) {
+    IntrusiveIteratorPtrT iter = (IntrusiveIteratorPtrT)iterator;
+    if(iter == NULL || object == NULL || LSQ_IsIntrusiveIteratorBeforeFirst(iter)) return;
+    
+    LinkBefore(iter->handle, iter->link, GetLink(iter->handle, object));
+    iter->link = iter->link->previousLink;
+}
+
+extern void LSQ_DeleteIntrusiveFrontElement(LSQ_HandleT handle) {
+    IntrusiveListPtrT list = (IntrusiveListPtrT)handle;
+    if(list == LSQ_HandleInvalid || list->size == 0) return;
+    Unlink(list, list->beforeFirst.nextLink);
+}
+
+extern void LSQ_DeleteIntrusiveRearElement(LSQ_HandleT handle) {
+    IntrusiveListPtrT list = (IntrusiveListPtrT)handle;
+    if(list == LSQ_HandleInvalid || list->size == 0) return;
+    Unlink(list, list->pastRear.previousLink);
+}
+
+extern void LSQ_DeleteIntrusiveGivenElement(LSQ_IteratorT iterator) {
+    IntrusiveIteratorPtrT iter = (IntrusiveIteratorPtrT)iterator;
+    LSQ_IntrusiveLinkT* next;
+    if(!LSQ_IsIntrusiveIteratorDereferencable(iter)) return;
+    
+    next = iter->link->nextLink;
+    Unlink(iter->handle, iter->link);
+    iter->link = next;
+}
+
+extern void LSQ_DeleteIntrusiveElement(LSQ_HandleT handle, void* object) {
+    if(handle == LSQ_HandleInvalid || object == NULL) return;
+    Unlink((IntrusiveListPtrT)handle, GetLink((IntrusiveListPtrT)handle, object));
+}
@@ -0,0 +1,80 @@
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#include <stddef.h>
+#include "linear_sequence.h"
+
+/*  :  LSQ_IntrusiveLinkT     ,       *
+ *   ,      .           *
+ * ,    .      .       *
+ *    linear_sequence.h; ,   ,    .    */
+
+/* ,    */
+typedef struct LSQ_IntrusiveLink {
+    struct LSQ_IntrusiveLink* nextLink;
+    struct LSQ_IntrusiveLink* previousLink;
+}   LSQ_IntrusiveLinkT;
+
+/* ,      type      member */
+#define LSQ_CONTAINER_OF(link, type, member) ((type*)((char*)(link) - offsetof(type, member)))
+
+/* ,     ,      linkOffset *
+ * ( offsetof(type, member)).                              */
+extern LSQ_HandleT LSQ_CreateIntrusiveSequence(size_t linkOffset);
+/* ,  .   ,       */
+extern void LSQ_DestroyIntrusiveSequence(LSQ_HandleT handle);
+
+/* ,       */
+extern LSQ_IntegerIndexT LSQ_GetIntrusiveSize(LSQ_HandleT handle);
+
+/* , ,       */
+extern int LSQ_IsIntrusiveIteratorDereferencable(LSQ_IteratorT iterator);
+/* , ,      ,      */
+extern int LSQ_IsIntrusiveIteratorPastRear(LSQ_IteratorT iterator);
+/* , ,      ,     */
+extern int LSQ_IsIntrusiveIteratorBeforeFirst(LSQ_IteratorT iterator);
+
+/* ,  .    ,     */
+extern void* LSQ_DereferenceIntrusiveIterator(LSQ_IteratorT iterator);
+
+/*            */
+/* ,  ,       */
+extern LSQ_IteratorT LSQ_GetIntrusiveElementByIndex(LSQ_HandleT handle, LSQ_IntegerIndexT index);
+/* ,  ,      */
+extern LSQ_IteratorT LSQ_GetIntrusiveFrontElement(LSQ_HandleT handle);
+/* ,  ,   ,    */
+extern LSQ_IteratorT LSQ_GetIntrusivePastRearElement(LSQ_HandleT handle);
+/* ,  ,   ,    .   O(1) */
+extern LSQ_IteratorT LSQ_GetIntrusiveIteratorOf(LSQ_HandleT handle, void* object);
+
+/* ,           */
+extern void LSQ_DestroyIntrusiveIterator(LSQ_IteratorT iterator);
+
+/* ,       */
+extern void LSQ_AdvanceOneIntrusiveElement(LSQ_IteratorT iterator);
+/* ,       */
+extern void LSQ_RewindOneIntrusiveElement(LSQ_IteratorT iterator);
+/* ,        */
+extern void LSQ_ShiftIntrusivePosition(LSQ_IteratorT iterator, LSQ_IntegerIndexT shift);
+/* ,        */
+extern void LSQ_SetIntrusivePosition(LSQ_IteratorT iterator, LSQ_IntegerIndexT pos);
+
+/* ,      */
+extern void LSQ_InsertIntrusiveFrontElement(LSQ_HandleT handle, void* object);
+/* ,      */
+extern void LSQ_InsertIntrusiveRearElement(LSQ_HandleT handle, void* object);
+/* ,      ,    .   *
+ *                                                                */
+extern void LSQ_InsertIntrusiveElementBeforeGiven(LSQ_IteratorT iterator, void* object);
+
+/* ,      */
+extern void LSQ_DeleteIntrusiveFrontElement(LSQ_HandleT handle);
+/* ,      */
+extern void LSQ_DeleteIntrusiveRearElement(LSQ_HandleT handle);
+/* ,    ,    .    *
+ *                                                                          */
+extern void LSQ_DeleteIntrusiveGivenElement(LSQ_IteratorT iterator);
+/* ,     ,    */
+extern void LSQ_DeleteIntrusiveElement(LSQ_HandleT handle, void* object);
+
+#endif
@@ -4,8 +4,13 @@
 
 #include <stdlib.h>
 
+/*          LSQ_BASE_TYPE (  int) */
+#ifndef LSQ_BASE_TYPE
+#define LSQ_BASE_TYPE int
+#endif
+
 /*      */
-typedef int LSQ_BaseTypeT;
+typedef LSQ_BASE_TYPE LSQ_BaseTypeT;
 
 /*   */
 typedef void* LSQ_HandleT;
@@ -19,8 +24,23 @@ typedef void* LSQ_IteratorT;
 /*     */
 typedef int LSQ_IntegerIndexT;
 
+/*   . LSQ_LAYOUT_LINKED -     . LSQ_LAYOUT_UNROLLED - *
+ *  ,       :           *
+ * ,    ,           .  *
+ *   ,     ,     ,      *
+ *      .                                                 *
+ * LSQ_LAYOUT_INDEXED -      (  ):           *
+ *     O(log n),    -   O(log n).                         */
+typedef enum {
+    LSQ_LAYOUT_LINKED,
+    LSQ_LAYOUT_UNROLLED,
+    LSQ_LAYOUT_INDEXED
+}   LSQ_SequenceLayoutT;
+
 /* ,   .     */
 extern LSQ_HandleT LSQ_CreateSequence(void);
+/* ,         */
+extern LSQ_HandleT LSQ_CreateSequenceWithLayout(LSQ_SequenceLayoutT layout);
 /* ,     .     */
 extern void LSQ_DestroySequence(LSQ_HandleT handle);
 
@@ -73,4 +93,23 @@ extern void LSQ_DeleteRearElement(LSQ_HandleT handle);
  *     .                                                                                    */
 extern void LSQ_DeleteGivenElement(LSQ_IteratorT iterator);
 
+/*           ,      *
+ * .     LSQ_LAYOUT_LINKED;        *
+ *  LSQ_GetSize. ,  ,    ,      *
+ *   .                                                                  *
+ *      ,   (  LSQ_SplitAt -   )  *
+ *     . ,    ,         *
+ *      ,  LSQ_DestroySequence           *
+ *        .                                                   */
+/* ,    first  last (  last)   destination.     *
+ * first    destination.      destination       *
+ *     first  last (  last):   ,    ,   *
+ *     .  0,                                              */
+extern int LSQ_Splice(LSQ_IteratorT destination, LSQ_IteratorT first, LSQ_IteratorT last);
+/* ,  ,    ,              *
+ * .                                                              */
+extern LSQ_HandleT LSQ_SplitAt(LSQ_IteratorT iterator);
+/* ,        .  0,    */
+extern int LSQ_Concatenate(LSQ_HandleT first, LSQ_HandleT second);
+
 #endif
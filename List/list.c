@@ -1,4 +1,6 @@
 #include "linear_sequence.h"
+#include "node_pool.h"
+#include "unrolled_list.h"
 
 typedef struct Element{
     LSQ_BaseTypeT data;
@@ -6,62 +8,341 @@ typedef struct Element{
     struct Element* previousElement;
 }   ElementT, *ElementPtrT;
 
+/*   (LSQ_LAYOUT_INDEXED) -       .       *
+ *  1/INDEX_LEVEL_PROBABILITY   .          *
+ * ,        .                */
+#define INDEX_MAX_LEVEL 32
+#define INDEX_LEVEL_PROBABILITY 4
+/* ,       ,      */
+#define INDEX_SHIFT_THRESHOLD 16
+
+typedef struct {
+    struct Element* nextElement;
+    struct Element* previousElement;
+    LSQ_IntegerIndexT span;
+}   IndexLinkT, *IndexLinkPtrT;
+
+/*   .  element   :   ElementT  IndexedElementT *
+ * . link[i] -   i + 1,     height > 0                   */
+typedef struct {
+    ElementT element;
+    int height;
+    IndexLinkPtrT link;
+}   IndexedElementT, *IndexedElementPtrT;
+
+#define INDEXED(element) ((IndexedElementPtrT)(element))
+
+/* ,  -1, ,           *
+ *                                                                       */
 typedef struct {
     int size;
     ElementPtrT beforeFirst, pastRear;
+    NodePoolPtrT pool;
+    UnrolledListPtrT unrolled;
+    int indexed, levels;
+    unsigned int seed;
 }   ListT, *ListPtrT;
 
 typedef struct {
     ListPtrT handle;
     ElementPtrT element;
+    UnrolledCursorT cursor;
 }   IteratorT, *IteratorPtrT;
 
-/* ,   .     */
-extern LSQ_HandleT LSQ_CreateSequence(void) {
+static ListPtrT CreateListWithPool(NodePoolPtrT, int);
+static int IsLinkedList(ListPtrT);
+static int ShareNodePool(ListPtrT, ListPtrT);
+static int CreateIndexSentinels(ListPtrT);
+static void DestroyIndex(ListPtrT);
+static int GetRandomHeight(ListPtrT);
+static void FindIndexPredecessors(ListPtrT, ElementPtrT, ElementPtrT*, LSQ_IntegerIndexT*);
+static void InsertIntoIndex(ListPtrT, ElementPtrT);
+static void DeleteFromIndex(ListPtrT, ElementPtrT);
+static LSQ_IntegerIndexT GetIndexOfElement(ListPtrT, ElementPtrT);
+static ElementPtrT GetElementAtIndex(ListPtrT, LSQ_IntegerIndexT);
+
+/* ,   ,       */
+static ListPtrT CreateListWithPool(NodePoolPtrT pool, int indexed) {
     ListPtrT handle = (ListPtrT)malloc(sizeof(ListT));
-    if(handle == NULL) return LSQ_HandleInvalid;
-    
-    handle->beforeFirst = (ElementPtrT)malloc(sizeof(ElementT));
-    if(handle->beforeFirst == NULL) {
-        free(handle);
-        return LSQ_HandleInvalid;
-    }
+    if(handle == NULL) return NULL;
     
-    handle->pastRear = (ElementPtrT)malloc(sizeof(ElementT));
-    if(handle->pastRear == NULL) {
-        free(handle->beforeFirst);
+    handle->unrolled = NULL;
+    handle->indexed = indexed;
+    handle->pool = pool;
+    handle->beforeFirst = (ElementPtrT)AllocateNode(pool);
+    handle->pastRear = (ElementPtrT)AllocateNode(pool);
+    if(handle->beforeFirst == NULL || handle->pastRear == NULL || (indexed && !CreateIndexSentinels(handle))) {
+        FreeNode(pool, handle->beforeFirst);
+        FreeNode(pool, handle->pastRear);
         free(handle);
-        return LSQ_HandleInvalid;
+        return NULL;
     }
+    RetainNodePool(pool);
     
     handle->size = 0;
     handle->beforeFirst->nextElement = handle->pastRear;
     handle->beforeFirst->previousElement = NULL;
     handle->pastRear->nextElement = NULL;
     handle->pastRear->previousElement = handle->beforeFirst;
+    return handle;
+}
+
+/* , ,          .   *
+ *     :       ,     *
+ *                                                                              */
+static int IsLinkedList(ListPtrT list) {
+    return list != NULL && list->unrolled == NULL && !list->indexed;
+}
+
+/* ,    ,          */
+static int ShareNodePool(ListPtrT first, ListPtrT second) {
+    NodePoolPtrT pool = MergeNodePools(first->pool, second->pool);
+    if(pool == NULL) return 0;
     
+    if(first->pool != pool) {
+        RetainNodePool(pool);
+        ReleaseNodePool(first->pool);
+        first->pool = pool;
+    }
+    if(second->pool != pool) {
+        RetainNodePool(pool);
+        ReleaseNodePool(second->pool);
+        second->pool = pool;
+    }
+    return 1;
+}
+
+/* ,      .    ,   *
+ *                                                                             */
+static int CreateIndexSentinels(ListPtrT list) {
+    IndexedElementPtrT beforeFirst = INDEXED(list->beforeFirst), pastRear = INDEXED(list->pastRear);
+    int i;
+    
+    beforeFirst->link = (IndexLinkPtrT)malloc(sizeof(IndexLinkT) * INDEX_MAX_LEVEL);
+    pastRear->link = (IndexLinkPtrT)malloc(sizeof(IndexLinkT) * INDEX_MAX_LEVEL);
+    if(beforeFirst->link == NULL || pastRear->link == NULL) {
+        free(beforeFirst->link);
+        free(pastRear->link);
+        return 0;
+    }
+    beforeFirst->height = pastRear->height = INDEX_MAX_LEVEL;
+    for(i = 0; i < INDEX_MAX_LEVEL; i++) {
+        beforeFirst->link[i].nextElement = list->pastRear;
+        beforeFirst->link[i].previousElement = NULL;
+        beforeFirst->link[i].span = 1;
+        pastRear->link[i].nextElement = NULL;
+        pastRear->link[i].previousElement = list->beforeFirst;
+        pastRear->link[i].span = 0;
+    }
+    list->levels = 0;
+    list->seed = 2463534242u;
+    return 1;
+}
+
+/* ,   .  ,  ,     */
+static void DestroyIndex(ListPtrT list) {
+    ElementPtrT element = list->beforeFirst, next;
+    
+    while(element != NULL) {
+        next = INDEXED(element)->link[0].nextElement;
+        free(INDEXED(element)->link);
+        element = next;
+    }
+}
+
+/* ,     .  - xorshift */
+static int GetRandomHeight(ListPtrT list) {
+    int height = 0;
+    
+    list->seed ^= list->seed << 13;
+    list->seed ^= list->seed >> 17;
+    list->seed ^= list->seed << 5;
+    while(height < INDEX_MAX_LEVEL - 1 && (list->seed >> (2 * height)) % INDEX_LEVEL_PROBABILITY == 0)
+        height++;
+    return height;
+}
+
+/* ,            *
+ *      .   ,    ,        */
+static void FindIndexPredecessors(ListPtrT list, ElementPtrT element, ElementPtrT* predecessor, LSQ_IntegerIndexT* distance) {
+    ElementPtrT node = element->previousElement;
+    LSQ_IntegerIndexT steps = 1;
+    int level;
+    
+    for(level = 1; level <= list->levels; level++) {
+        while(INDEXED(node)->height < level) {
+            if(level == 1) {
+                node = node->previousElement;
+                steps++;
+            }
+            else {
+                node = INDEXED(node)->link[level - 2].previousElement;
+                steps += INDEXED(node)->link[level - 2].span;
+            }
+        }
+        predecessor[level - 1] = node;
+        distance[level - 1] = steps;
+    }
+}
+
+/* ,    ,      */
+static void InsertIntoIndex(ListPtrT list, ElementPtrT element) {
+    ElementPtrT predecessor[INDEX_MAX_LEVEL];
+    LSQ_IntegerIndexT distance[INDEX_MAX_LEVEL];
+    IndexedElementPtrT indexed = INDEXED(element), previous;
+    int level, height = GetRandomHeight(list);
+    
+    indexed->link = height > 0 ? (IndexLinkPtrT)malloc(sizeof(IndexLinkT) * height) : NULL;
+    indexed->height = indexed->link != NULL ? height : 0;
+    for(; list->levels < indexed->height; list->levels++) {
+        INDEXED(list->beforeFirst)->link[list->levels].nextElement = list->pastRear;
+        INDEXED(list->beforeFirst)->link[list->levels].span = list->size;
+        INDEXED(list->pastRear)->link[list->levels].previousElement = list->beforeFirst;
+    }
+    FindIndexPredecessors(list, element, predecessor, distance);
+    for(level = 0; level < list->levels; level++) {
+        previous = INDEXED(predecessor[level]);
+        if(level < indexed->height) {
+            indexed->link[level].nextElement = previous->link[level].nextElement;
+            indexed->link[level].previousElement = predecessor[level];
+            indexed->link[level].span = previous->link[level].span + 1 - distance[level];
+            INDEXED(indexed->link[level].nextElement)->link[level].previousElement = element;
+            previous->link[level].nextElement = element;
+            previous->link[level].span = distance[level];
+        }
+        else {
+            previous->link[level].span++;
+        }
+    }
+}
+
+/* ,    .        */
+static void DeleteFromIndex(ListPtrT list, ElementPtrT element) {
+    ElementPtrT predecessor[INDEX_MAX_LEVEL];
+    LSQ_IntegerIndexT distance[INDEX_MAX_LEVEL];
+    IndexedElementPtrT indexed = INDEXED(element), previous;
+    int level;
+    
+    FindIndexPredecessors(list, element, predecessor, distance);
+    for(level = 0; level < list->levels; level++) {
+        previous = INDEXED(predecessor[level]);
+        if(level < indexed->height) {
+            previous->link[level].nextElement = indexed->link[level].nextElement;
+            previous->link[level].span += indexed->link[level].span - 1;
+            INDEXED(indexed->link[level].nextElement)->link[level].previousElement = predecessor[level];
+        }
+        else {
+            previous->link[level].span--;
+        }
+    }
+    free(indexed->link);
+}
+
+/* ,   :         */
+static LSQ_IntegerIndexT GetIndexOfElement(ListPtrT list, ElementPtrT element) {
+    LSQ_IntegerIndexT index = -1;
+    int level = 0;
+    
+    if(element == list->pastRear) return list->size;
+    while(element != list->beforeFirst) {
+        if(INDEXED(element)->height > level)
+            level = INDEXED(element)->height < list->levels ? INDEXED(element)->height : list->levels;
+        if(level == 0) {
+            element = element->previousElement;
+            index++;
+        }
+        else {
+            element = INDEXED(element)->link[level - 1].previousElement;
+            index += INDEXED(element)->link[level - 1].span;
+        }
+    }
+    return index;
+}
+
+/* ,     .       */
+static ElementPtrT GetElementAtIndex(ListPtrT list, LSQ_IntegerIndexT index) {
+    ElementPtrT element = list->beforeFirst;
+    LSQ_IntegerIndexT position = -1;
+    int level;
+    
+    if(index < 0) return list->beforeFirst;
+    if(index >= list->size) return list->pastRear;
+    for(level = list->levels; level > 0; level--) {
+        while(position + INDEXED(element)->link[level - 1].span <= index) {
+            position += INDEXED(element)->link[level - 1].span;
+            element = INDEXED(element)->link[level - 1].nextElement;
+        }
+    }
+    for(; position < index; position++)
+        element = element->nextElement;
+    return element;
+}
+
+/* ,   .     */
+extern LSQ_HandleT LSQ_CreateSequence(void) {
+    return LSQ_CreateSequenceWithLayout(LSQ_LAYOUT_LINKED);
+}
+
+/* ,         */
+extern LSQ_HandleT LSQ_CreateSequenceWithLayout(LSQ_SequenceLayoutT layout) {
+    ListPtrT handle;
+    NodePoolPtrT pool;
+    
+    if(layout == LSQ_LAYOUT_UNROLLED) {
+        handle = (ListPtrT)malloc(sizeof(ListT));
+        if(handle == NULL) return LSQ_HandleInvalid;
+        handle->unrolled = CreateUnrolledList();
+        if(handle->unrolled == NULL) {
+            free(handle);
+            return LSQ_HandleInvalid;
+        }
+        handle->size = 0;
+        handle->indexed = 0;
+        handle->beforeFirst = handle->pastRear = NULL;
+        handle->pool = NULL;
+        return handle;
+    }
+    
+    pool = CreateNodePool(layout == LSQ_LAYOUT_INDEXED ? sizeof(IndexedElementT) : sizeof(ElementT));
+    if(pool == NULL) return LSQ_HandleInvalid;
+    handle = CreateListWithPool(pool, layout == LSQ_LAYOUT_INDEXED);
+    ReleaseNodePool(pool);
     return handle;
 }
 
-/* ,     .     */
+/* ,     .    .     *
+ *   :      ,   .      *
+ * ,                                               */
 extern void LSQ_DestroySequence(LSQ_HandleT handle) {    
     if(handle == LSQ_HandleInvalid) return;
-    IteratorPtrT iterator = LSQ_GetFrontElement(handle);
+    ListPtrT list = (ListPtrT)handle;
+    ElementPtrT element, next;
     
-    while(!LSQ_IsIteratorPastRear(iterator)) {
-        free(iterator->element->previousElement);
-        LSQ_AdvanceOneElement(iterator);
+    if(list->unrolled == NULL && IsNodePoolShared(list->pool)) {
+        for(element = list->beforeFirst; element != NULL; element = next) {
+            next = element->nextElement;
+            FreeNode(list->pool, element);
+        }
     }
-    free(iterator->element->previousElement);
-    free(iterator->element);
+    DestroyUnrolledList(((ListPtrT)handle)->unrolled);
+    if(((ListPtrT)handle)->indexed) DestroyIndex((ListPtrT)handle);
+    ReleaseNodePool(((ListPtrT)handle)->pool);
     free(handle);
-    LSQ_DestroyIterator(iterator);
 }
 
 /* ,       */
 extern LSQ_IntegerIndexT LSQ_GetSize(LSQ_HandleT handle) {
     if(handle == LSQ_HandleInvalid) return -1;
-    return ((ListPtrT)handle)->size;
+    ListPtrT list = (ListPtrT)handle;
+    ElementPtrT element;
+    
+    if(list->unrolled != NULL) return GetUnrolledSize(list->unrolled);
+    if(list->size < 0) {
+        list->size = 0;
+        for(element = list->beforeFirst->nextElement; element != list->pastRear; element = element->nextElement)
+            list->size++;
+    }
+    return list->size;
 }
 
 /*            */
@@ -69,7 +350,7 @@ extern LSQ_IntegerIndexT LSQ_GetSize(LSQ_HandleT handle) {
 extern LSQ_IteratorT LSQ_GetElementByIndex(LSQ_HandleT handle, LSQ_IntegerIndexT index) {
     if(handle == LSQ_HandleInvalid) return NULL;
     IteratorPtrT iterator = (IteratorPtrT)LSQ_GetFrontElement(handle);
-    LSQ_ShiftPosition(iterator, index);
+    LSQ_SetPosition(iterator, index);
     return iterator;
 }
 
@@ -80,6 +361,11 @@ extern LSQ_IteratorT LSQ_GetFrontElement(LSQ_HandleT handle) {
     if(iterator == NULL) return NULL;
     iterator->handle = (ListPtrT)handle;
     iterator->element = ((ListPtrT)handle)->beforeFirst;
+    iterator->cursor.nextCursor = iterator->cursor.previousCursor = NULL;
+    if(iterator->handle->unrolled != NULL) {
+        iterator->cursor.position = GetUnrolledBeforeFirst(iterator->handle->unrolled);
+        AttachUnrolledCursor(iterator->handle->unrolled, &iterator->cursor);
+    }
     LSQ_AdvanceOneElement(iterator);
     return iterator;
 }
@@ -91,29 +377,42 @@ extern LSQ_IteratorT LSQ_GetPastRearElement(LSQ_HandleT handle) {
     if(iterator == NULL) return NULL;
     iterator->handle = (ListPtrT)handle;
     iterator->element = ((ListPtrT)handle)->pastRear;
+    iterator->cursor.nextCursor = iterator->cursor.previousCursor = NULL;
+    if(iterator->handle->unrolled != NULL) {
+        iterator->cursor.position = GetUnrolledPastRear(iterator->handle->unrolled);
+        AttachUnrolledCursor(iterator->handle->unrolled, &iterator->cursor);
+    }
     return iterator;
 }
 
-/* ,           */
+/* ,          .  *
+ *     ,                 */
 extern void LSQ_DestroyIterator(LSQ_IteratorT iterator) {
+    if(iterator == NULL) return;
+    DetachUnrolledCursor(&((IteratorPtrT)iterator)->cursor);
     free(iterator);
 }
 
 /* , ,       */
 extern int LSQ_IsIteratorDereferencable(LSQ_IteratorT iterator) {
     if(iterator == NULL) return 0;
+    if(((IteratorPtrT)iterator)->handle->unrolled != NULL) return GetUnrolledElement(((IteratorPtrT)iterator)->cursor.position) != NULL;
     return !LSQ_IsIteratorPastRear(iterator) && !LSQ_IsIteratorBeforeFirst(iterator);
 }
 
 /* , ,      ,      */
 extern int LSQ_IsIteratorPastRear(LSQ_IteratorT iterator) {
     if(iterator == NULL) return 0;
+    if(((IteratorPtrT)iterator)->handle->unrolled != NULL)
+        return IsUnrolledPastRear(((IteratorPtrT)iterator)->handle->unrolled, ((IteratorPtrT)iterator)->cursor.position);
     return ((IteratorPtrT)iterator)->element == ((IteratorPtrT)iterator)->handle->pastRear;
 }
 
 /* , ,      ,     */
 extern int LSQ_IsIteratorBeforeFirst(LSQ_IteratorT iterator) {
     if(iterator == NULL) return 0;
+    if(((IteratorPtrT)iterator)->handle->unrolled != NULL)
+        return IsUnrolledBeforeFirst(((IteratorPtrT)iterator)->handle->unrolled, ((IteratorPtrT)iterator)->cursor.position);
     return ((IteratorPtrT)iterator)->element == ((IteratorPtrT)iterator)->handle->beforeFirst;
 }
 
@@ -121,6 +420,7 @@ extern int LSQ_IsIteratorBeforeFirst(LSQ_IteratorT iterator) {
 extern LSQ_BaseTypeT* LSQ_DereferenceIterator(LSQ_IteratorT iterator) {
     if(iterator == NULL || ((IteratorPtrT)iterator)->handle == LSQ_HandleInvalid
     || !LSQ_IsIteratorDereferencable(iterator)) return NULL;
+    if(((IteratorPtrT)iterator)->handle->unrolled != NULL) return GetUnrolledElement(((IteratorPtrT)iterator)->cursor.position);
     return &(((IteratorPtrT)iterator)->element->data);
 }
 
@@ -137,8 +437,22 @@ extern void LSQ_RewindOneElement(LSQ_IteratorT iterator) {
 /* ,        */
 extern void LSQ_ShiftPosition(LSQ_IteratorT iterator, LSQ_IntegerIndexT shift) {
     if(iterator == NULL || ((IteratorPtrT)iterator)->handle == LSQ_HandleInvalid) return;
+    ListPtrT list = ((IteratorPtrT)iterator)->handle;
+    LSQ_IntegerIndexT index;
     int i;
     
+    if(list->indexed && (shift > INDEX_SHIFT_THRESHOLD || shift < -INDEX_SHIFT_THRESHOLD)) {
+        index = GetIndexOfElement(list, ((IteratorPtrT)iterator)->element);
+        LSQ_SetPosition(iterator, shift > 0 ? (shift < list->size - index ? index + shift : list->size) 
+                                            : (-shift <= index ? index + shift : -1));
+        return;
+    }
+    if(((IteratorPtrT)iterator)->handle->unrolled != NULL) {
+        UnrolledPositionT* position = &((IteratorPtrT)iterator)->cursor.position;
+        if(shift == 1 && position->offset + 1 < position->node->count) position->offset++;
+        else ShiftUnrolledPosition(position, shift);
+        return;
+    }
     if(shift > 0) {
         for(i = 0; i < shift && !LSQ_IsIteratorPastRear(iterator); i++) {
             ((IteratorPtrT)iterator)->element = ((IteratorPtrT)iterator)->element->nextElement;
@@ -151,13 +465,21 @@ extern void LSQ_ShiftPosition(LSQ_IteratorT iterator, LSQ_IntegerIndexT shift) {
     }
 }
 
-/* ,        */
+/* ,       .     *
+ *  O(log n),                             */
 extern void LSQ_SetPosition(LSQ_IteratorT iterator, LSQ_IntegerIndexT pos) {
     if(iterator == NULL) return;
-    IteratorPtrT iter = LSQ_GetFrontElement(((IteratorPtrT)iterator)->handle);
-    LSQ_ShiftPosition(iter, pos);
-    ((IteratorPtrT)iterator)->element = iter->element;
-    LSQ_DestroyIterator(iter);
+    IteratorPtrT iter = (IteratorPtrT)iterator;
+    
+    if(iter->handle->indexed) {
+        iter->element = GetElementAtIndex(iter->handle, pos);
+        return;
+    }
+    if(pos < 0) pos = -1;
+    iter->element = iter->handle->beforeFirst;
+    if(iter->handle->unrolled != NULL)
+        iter->cursor.position = GetUnrolledBeforeFirst(iter->handle->unrolled);
+    LSQ_ShiftPosition(iter, pos + 1);
 }
 
 /* ,      */
@@ -181,7 +503,13 @@ extern void LSQ_InsertRearElement(LSQ_HandleT handle, LSQ_BaseTypeT element) {
 extern void LSQ_InsertElementBeforeGiven(LSQ_IteratorT iterator, LSQ_BaseTypeT newElement) {
     if(iterator == NULL || LSQ_IsIteratorBeforeFirst(iterator)) return;
     IteratorPtrT iter = (IteratorPtrT)iterator;
-    ElementPtrT element = (ElementPtrT)malloc(sizeof(ElementT));
+    ElementPtrT element;
+    
+    if(iter->handle->unrolled != NULL) {
+        InsertUnrolledElement(iter->handle->unrolled, &iter->cursor.position, newElement);
+        return;
+    }
+    element = (ElementPtrT)AllocateNode(iter->handle->pool);
     if(element == NULL) return;
     
     element->nextElement = iter->element;
@@ -190,7 +518,8 @@ extern void LSQ_InsertElementBeforeGiven(LSQ_IteratorT iterator, LSQ_BaseTypeT n
     iter->element->previousElement->nextElement = element;
     iter->element->previousElement = element;
     iter->element = element;
-    iter->handle->size++;
+    if(iter->handle->size >= 0) iter->handle->size++;
+    if(iter->handle->indexed) InsertIntoIndex(iter->handle, element);
 }
 
 /* ,     */
@@ -218,11 +547,93 @@ extern void LSQ_DeleteGivenElement(LSQ_IteratorT iterator) {
     if(iterator == NULL) return;
     IteratorPtrT iter = (IteratorPtrT)iterator;
     if(iter == NULL || !LSQ_IsIteratorDereferencable(iter)) return;
+    if(iter->handle->unrolled != NULL) {
+        DeleteUnrolledElement(iter->handle->unrolled, &iter->cursor.position);
+        return;
+    }
+    if(iter->handle->indexed) DeleteFromIndex(iter->handle, iter->element);
     ElementPtrT previousElement = iter->element->previousElement;
     ElementPtrT nextElement = iter->element->nextElement;
     previousElement->nextElement = nextElement;
     nextElement->previousElement = previousElement;
-    free(iter->element);
+    FreeNode(iter->handle->pool, iter->element);
     iter->element = nextElement;
-    iter->handle->size--;
+    if(iter->handle->size >= 0) iter->handle->size--;
+}
+
+/* ,    first  last (  last)         *
+ *  destination.   ,       ;     *
+ *      .  first    destination. *
+ *  0,                                                                     */
+extern int LSQ_Splice(LSQ_IteratorT destination, LSQ_IteratorT first, LSQ_IteratorT last) {
+    IteratorPtrT target = (IteratorPtrT)destination, from = (IteratorPtrT)first, to = (IteratorPtrT)last;
+    ElementPtrT head, tail;
+    
+    if(target == NULL || from == NULL || to == NULL || from->handle != to->handle) return 0;
+    if(!IsLinkedList(target->handle) || !IsLinkedList(from->handle)) return 0;
+    if(from->element == to->element || target->element == from->element || target->element == to->element) return 1;
+    if(LSQ_IsIteratorBeforeFirst(target) || !LSQ_IsIteratorDereferencable(from) || LSQ_IsIteratorBeforeFirst(to)) return 0;
+    if(target->handle != from->handle && !ShareNodePool(target->handle, from->handle)) return 0;
+    
+    head = from->element;
+    tail = to->element->previousElement;
+    head->previousElement->nextElement = to->element;
+    to->element->previousElement = head->previousElement;
+    head->previousElement = target->element->previousElement;
+    tail->nextElement = target->element;
+    target->element->previousElement->nextElement = head;
+    target->element->previousElement = tail;
+    if(target->handle != from->handle) {
+        target->handle->size = -1;
+        from->handle->size = -1;
+        from->handle = target->handle;
+    }
+    return 1;
+}
+
+/* ,    ,    ,   .  *
+ *    .                                      */
+extern LSQ_HandleT LSQ_SplitAt(LSQ_IteratorT iterator) {
+    IteratorPtrT iter = (IteratorPtrT)iterator;
+    ListPtrT list, tail;
+    ElementPtrT first, last;
+    
+    if(iter == NULL || !IsLinkedList(iter->handle) || LSQ_IsIteratorBeforeFirst(iter)) return LSQ_HandleInvalid;
+    list = iter->handle;
+    tail = CreateListWithPool(list->pool, 0);
+    if(tail == NULL || LSQ_IsIteratorPastRear(iter)) return tail;
+    
+    first = iter->element;
+    last = list->pastRear->previousElement;
+    first->previousElement->nextElement = list->pastRear;
+    list->pastRear->previousElement = first->previousElement;
+    first->previousElement = tail->beforeFirst;
+    tail->beforeFirst->nextElement = first;
+    last->nextElement = tail->pastRear;
+    tail->pastRear->previousElement = last;
+    tail->size = list->size = -1;
+    iter->handle = tail;
+    return tail;
+}
+
+/* ,        .     */
+extern int LSQ_Concatenate(LSQ_HandleT first, LSQ_HandleT second) {
+    ListPtrT list = (ListPtrT)first, other = (ListPtrT)second;
+    ElementPtrT head, tail;
+    
+    if(!IsLinkedList(list) || !IsLinkedList(other) || list == other) return 0;
+    if(other->beforeFirst->nextElement == other->pastRear) return 1;
+    if(!ShareNodePool(list, other)) return 0;
+    
+    head = other->beforeFirst->nextElement;
+    tail = other->pastRear->previousElement;
+    other->beforeFirst->nextElement = other->pastRear;
+    other->pastRear->previousElement = other->beforeFirst;
+    head->previousElement = list->pastRear->previousElement;
+    list->pastRear->previousElement->nextElement = head;
+    tail->nextElement = list->pastRear;
+    list->pastRear->previousElement = tail;
+    list->size = list->size >= 0 && other->size >= 0 ? list->size + other->size : -1;
+    other->size = 0;
+    return 1;
 }
@@ -0,0 +1,137 @@
+#include "node_pool.h"
+
+#define INITIAL_SLAB_SIZE 32
+#define MAXIMAL_SLAB_SIZE 4096
+
+/*   .     ,    */
+typedef union Slab {
+    union Slab* next;
+    long double alignment;
+    void* pointer;
+}   SlabT, *SlabPtrT;
+
+typedef struct FreeNode {
+    struct FreeNode* next;
+}   FreeNodeT, *FreeNodePtrT;
+
+/* ,   ,   parent  ,     ,     . *
+ *     ,     parent                                  */
+struct NodePool {
+    size_t nodeSize;
+    int owners;
+    int slabSize;
+    SlabPtrT slabs, lastSlab;
+    FreeNodePtrT freeNodes, lastFreeNode;
+    char *unused, *unusedEnd;
+    struct NodePool* parent;
+};
+
+static int AllocateSlab(NodePoolPtrT pool);
+static NodePoolPtrT FindNodePool(NodePoolPtrT pool);
+
+/* ,   .      ,    *
+ * MAXIMAL_SLAB_SIZE                                                                           */
+static int AllocateSlab(NodePoolPtrT pool) {
+    SlabPtrT slab = (SlabPtrT)malloc(sizeof(SlabT) + pool->nodeSize * pool->slabSize);
+    
+    if(slab == NULL) return 0;
+    slab->next = pool->slabs;
+    if(pool->slabs == NULL) pool->lastSlab = slab;
+    pool->slabs = slab;
+    pool->unused = (char*)(slab + 1);
+    pool->unusedEnd = pool->unused + pool->nodeSize * pool->slabSize;
+    if(pool->slabSize < MAXIMAL_SLAB_SIZE) pool->slabSize *= 2;
+    return 1;
+}
+
+/* ,  ,     */
+static NodePoolPtrT FindNodePool(NodePoolPtrT pool) {
+    while(pool->parent != NULL)
+        pool = pool->parent;
+    return pool;
+}
+
+extern NodePoolPtrT CreateNodePool(size_t nodeSize) {
+    NodePoolPtrT pool = (NodePoolPtrT)malloc(sizeof(NodePoolT));
+    if(pool == NULL) return NULL;
+    
+    if(nodeSize < sizeof(FreeNodeT)) nodeSize = sizeof(FreeNodeT);
+    pool->nodeSize = (nodeSize + sizeof(FreeNodeT) - 1) / sizeof(FreeNodeT) * sizeof(FreeNodeT);
+    pool->owners = 1;
+    pool->slabSize = INITIAL_SLAB_SIZE;
+    pool->slabs = pool->lastSlab = NULL;
+    pool->freeNodes = pool->lastFreeNode = NULL;
+    pool->parent = NULL;
+    pool->unused = pool->unusedEnd = NULL;
+    return pool;
+}
+
+extern void RetainNodePool(NodePoolPtrT pool) {
+    if(pool != NULL) pool->owners++;
+}
+
+extern void ReleaseNodePool(NodePoolPtrT pool) {
+    SlabPtrT slab;
+    if(pool == NULL || --pool->owners > 0) return;
+    
+    ReleaseNodePool(pool->parent);
+    while(pool->slabs != NULL) {
+        slab = pool->slabs;
+        pool->slabs = slab->next;
+        free(slab);
+    }
+    free(pool);
+}
+
+extern int IsNodePoolShared(NodePoolPtrT pool) {
+    return pool != NULL && (pool->parent != NULL || pool->owners > 1);
+}
+
+extern void* AllocateNode(NodePoolPtrT pool) {
+    void* node;
+    if(pool == NULL) return NULL;
+    
+    pool = FindNodePool(pool);
+    if(pool->freeNodes != NULL) {
+        node = pool->freeNodes;
+        pool->freeNodes = pool->freeNodes->next;
+        return node;
+    }
+    if(pool->unused == pool->unusedEnd && !AllocateSlab(pool)) return NULL;
+    node = pool->unused;
+    pool->unused += pool->nodeSize;
+    return node;
+}
+
+extern void FreeNode(NodePoolPtrT pool, void* node) {
+    if(pool == NULL || node == NULL) return;
+    pool = FindNodePool(pool);
+    if(pool->freeNodes == NULL) pool->lastFreeNode = (FreeNodePtrT)node;
+    ((FreeNodePtrT)node)->next = pool->freeNodes;
+    pool->freeNodes = (FreeNodePtrT)node;
+}
+
+extern NodePoolPtrT MergeNodePools(NodePoolPtrT first, NodePoolPtrT second) {
+    if(first == NULL || second == NULL || first->nodeSize != second->nodeSize) return NULL;
+    first = FindNodePool(first);
+    second = FindNodePool(second);
+    if(first == second) return first;
+    
+    if(second->slabs != NULL) {
+        second->lastSlab->next = first->slabs;
+        if(first->slabs == NULL) first->lastSlab = second->lastSlab;
+        first->slabs = second->slabs;
+    }
+    if(second->freeNodes != NULL) {
+        second->lastFreeNode->next = first->freeNodes;
+        if(first->freeNodes == NULL) first->lastFreeNode = second->lastFreeNode;
+        first->freeNodes = second->freeNodes;
+    }
+    if(first->slabSize < second->slabSize) first->slabSize = second->slabSize;
+    second->slabs = second->lastSlab = NULL;
+    second->freeNodes = second->lastFreeNode = NULL;
+    second->unused = second->unusedEnd = NULL;
+    second->parent = first;
+    first->owners++;
+    return first;
+}
@@ -0,0 +1,30 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <stdlib.h>
+
+/*    .       ,   *
+ *       .     ,      *
+ *    .                                                                       */
+typedef struct NodePool NodePoolT, *NodePoolPtrT;
+
+/* ,     nodeSize    */
+extern NodePoolPtrT CreateNodePool(size_t nodeSize);
+/* ,    */
+extern void RetainNodePool(NodePoolPtrT pool);
+/* ,  .         */
+extern void ReleaseNodePool(NodePoolPtrT pool);
+
+/* , ,            */
+extern int IsNodePoolShared(NodePoolPtrT pool);
+/* ,       ,           *
+ * .      ,                  *
+ * .  ,  ,  NULL,                          */
+extern NodePoolPtrT MergeNodePools(NodePoolPtrT first, NodePoolPtrT second);
+
+/* ,    .  NULL    */
+extern void* AllocateNode(NodePoolPtrT pool);
+/* ,     */
+extern void FreeNode(NodePoolPtrT pool, void* node);
+
+#endif
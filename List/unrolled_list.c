@@ -0,0 +1,216 @@
+#include "unrolled_list.h"
+#include <string.h>
+
+static UnrolledNodePtrT InsertNodeAfter(UnrolledListPtrT, UnrolledNodePtrT);
+static void RemoveNode(UnrolledListPtrT, UnrolledNodePtrT);
+static int SplitNode(UnrolledListPtrT, UnrolledPositionT*);
+static void MergeNodes(UnrolledListPtrT, UnrolledPositionT*);
+static void MoveCursors(UnrolledListPtrT, UnrolledNodePtrT, int, UnrolledNodePtrT, int);
+
+/* ,     .  NULL    */
+static UnrolledNodePtrT InsertNodeAfter(UnrolledListPtrT list, UnrolledNodePtrT previous) {
+    UnrolledNodePtrT node = (UnrolledNodePtrT)AllocateNode(list->pool);
+    
+    if(node == NULL) return NULL;
+    node->count = 0;
+    node->previousNode = previous;
+    node->nextNode = previous->nextNode;
+    previous->nextNode->previousNode = node;
+    previous->nextNode = node;
+    return node;
+}
+
+static void RemoveNode(UnrolledListPtrT list, UnrolledNodePtrT node) {
+    node->previousNode->nextNode = node->nextNode;
+    node->nextNode->previousNode = node->previousNode;
+    FreeNode(list->pool, node);
+}
+
+/* ,    node     offset   target     shift */
+static void MoveCursors(UnrolledListPtrT list, UnrolledNodePtrT node, int offset, UnrolledNodePtrT target, int shift) {
+    UnrolledCursorPtrT cursor;
+    
+    for(cursor = list->cursors.nextCursor; cursor != &list->cursors; cursor = cursor->nextCursor) {
+        if(cursor->position.node != node || cursor->position.offset < offset) continue;
+        cursor->position.node = target;
+        cursor->position.offset += shift;
+    }
+}
+
+/* ,     .          */
+static int SplitNode(UnrolledListPtrT list, UnrolledPositionT* position) {
+    UnrolledNodePtrT node = position->node, next = InsertNodeAfter(list, node);
+    int half = node->count / 2;
+    
+    if(next == NULL) return 0;
+    MoveCursors(list, node, half, next, -half);
+    next->count = node->count - half;
+    memcpy(next->data, node->data + half, sizeof(LSQ_BaseTypeT) * next->count);
+    node->count = half;
+    if(position->offset >= half) {
+        position->node = next;
+        position->offset -= half;
+    }
+    return 1;
+}
+
+/* ,   ,    ,  ,    *
+ *    .                          */
+static void MergeNodes(UnrolledListPtrT list, UnrolledPositionT* position) {
+    UnrolledNodePtrT node = position->node, other;
+    
+    if(node->count * 2 >= NODE_CAPACITY) return;
+    other = node->nextNode;
+    if(other != &list->pastRear && node->count + other->count <= NODE_CAPACITY) {
+        memcpy(node->data + node->count, other->data, sizeof(LSQ_BaseTypeT) * other->count);
+        MoveCursors(list, other, 0, node, node->count);
+        node->count += other->count;
+        RemoveNode(list, other);
+        return;
+    }
+    other = node->previousNode;
+    if(other != &list->beforeFirst && node->count + other->count <= NODE_CAPACITY) {
+        memcpy(other->data + other->count, node->data, sizeof(LSQ_BaseTypeT) * node->count);
+        MoveCursors(list, node, 0, other, other->count);
+        position->node = other;
+        position->offset += other->count;
+        other->count += node->count;
+        RemoveNode(list, node);
+    }
+}
+
+extern UnrolledListPtrT CreateUnrolledList(void) {
+    UnrolledListPtrT list = (UnrolledListPtrT)malloc(sizeof(UnrolledListT));
+    if(list == NULL) return NULL;
+    
+    list->pool = CreateNodePool(sizeof(UnrolledNodeT));
+    if(list->pool == NULL) {
+        free(list);
+        return NULL;
+    }
+    list->size = 0;
+    list->beforeFirst.count = list->pastRear.count = 0;
+    list->beforeFirst.previousNode = NULL;
+    list->beforeFirst.nextNode = &list->pastRear;
+    list->pastRear.previousNode = &list->beforeFirst;
+    list->pastRear.nextNode = NULL;
+    list->cursors.nextCursor = list->cursors.previousCursor = &list->cursors;
+    return list;
+}
+
+extern void DestroyUnrolledList(UnrolledListPtrT list) {
+    if(list == NULL) return;
+    while(list->cursors.nextCursor != &list->cursors)
+        DetachUnrolledCursor(list->cursors.nextCursor);
+    ReleaseNodePool(list->pool);
+    free(list);
+}
+
+extern void AttachUnrolledCursor(UnrolledListPtrT list, UnrolledCursorPtrT cursor) {
+    cursor->nextCursor = list->cursors.nextCursor;
+    cursor->previousCursor = &list->cursors;
+    list->cursors.nextCursor->previousCursor = cursor;
+    list->cursors.nextCursor = cursor;
+}
+
+extern void DetachUnrolledCursor(UnrolledCursorPtrT cursor) {
+    if(cursor->nextCursor == NULL) return;
+    cursor->nextCursor->previousCursor = cursor->previousCursor;
+    cursor->previousCursor->nextCursor = cursor->nextCursor;
+    cursor->nextCursor = cursor->previousCursor = NULL;
+}
+
+/*        ,      */
+extern void ShiftUnrolledPosition(UnrolledPositionT* position, LSQ_IntegerIndexT shift) {
+    UnrolledNodePtrT node = position->node;
+    LSQ_IntegerIndexT offset = position->offset;
+    
+    while(shift > 0 && node->nextNode != NULL) {
+        if(node->count == 0) {
+            node = node->nextNode;
+            shift--;
+        }
+        else if(offset + shift < node->count) {
+            offset += shift;
+            shift = 0;
+        }
+        else {
+            shift -= node->count - offset;
+            node = node->nextNode;
+            offset = 0;
+        }
+    }
+    while(shift < 0 && node->previousNode != NULL) {
+        if(node->count == 0 || offset == 0) {
+            node = node->previousNode;
+            offset = node->count > 0 ? node->count - 1 : 0;
+            shift++;
+        }
+        else if(offset + shift >= 0) {
+            offset += shift;
+            shift = 0;
+        }
+        else {
+            shift += offset;
+            offset = 0;
+        }
+    }
+    position->node = node;
+    position->offset = (int)offset;
+}
+
+/*     ,      -    .  *
+ * ,     ,                                       */
+extern int InsertUnrolledElement(UnrolledListPtrT list, UnrolledPositionT* position, LSQ_BaseTypeT element) {
+    UnrolledPositionT target = *position;
+    UnrolledNodePtrT node;
+    
+    if(target.node == &list->beforeFirst) return 0;
+    if(target.offset == 0 && target.node->previousNode->count > 0) {
+        target.node = target.node->previousNode;
+        target.offset = target.node->count;
+    }
+    if(target.node->count == 0) {
+        target.node = InsertNodeAfter(list, target.node->previousNode);
+        target.offset = 0;
+        if(target.node == NULL) return 0;
+    }
+    if(target.node->count == NODE_CAPACITY && !SplitNode(list, &target)) return 0;
+    node = target.node;
+    MoveCursors(list, node, target.offset, node, 1);
+    memmove(node->data + target.offset + 1, node->data + target.offset, 
+            sizeof(LSQ_BaseTypeT) * (node->count - target.offset));
+    node->data[target.offset] = element;
+    node->count++;
+    list->size++;
+    *position = target;
+    return 1;
+}
+
+extern void DeleteUnrolledElement(UnrolledListPtrT list, UnrolledPositionT* position) {
+    UnrolledPositionT target = *position;
+    UnrolledNodePtrT node = target.node;
+    
+    if(node->count == 0 || target.offset >= node->count) return;
+    node->count--;
+    memmove(node->data + target.offset, node->data + target.offset + 1, 
+            sizeof(LSQ_BaseTypeT) * (node->count - target.offset));
+    MoveCursors(list, node, target.offset + 1, node, -1);
+    list->size--;
+    if(node->count == 0) {
+        MoveCursors(list, node, 0, node->nextNode, 0);
+        target.node = node->nextNode;
+        target.offset = 0;
+        RemoveNode(list, node);
+        *position = target;
+        return;
+    }
+    MergeNodes(list, &target);
+    node = target.node;
+    MoveCursors(list, node, node->count, node->nextNode, -node->count);
+    if(target.offset == node->count) {
+        target.node = node->nextNode;
+        target.offset = 0;
+    }
+    *position = target;
+}
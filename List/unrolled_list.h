@@ -0,0 +1,100 @@
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+#include "linear_sequence.h"
+#include "node_pool.h"
+
+/*  :   ,        ( *
+ *   ).    ,    .       *
+ *     ,     .                          */
+/*         (   ) */
+#define UNROLLED_NODE_BYTES 128
+#define NODE_HEADER_BYTES (2 * sizeof(void*) + sizeof(int))
+#define NODE_CAPACITY (UNROLLED_NODE_BYTES > NODE_HEADER_BYTES + 2 * sizeof(LSQ_BaseTypeT) ? \
+                       (int)((UNROLLED_NODE_BYTES - NODE_HEADER_BYTES) / sizeof(LSQ_BaseTypeT)) : 2)
+
+/*  ,     ,     , *
+ *                                                                        */
+typedef struct UnrolledNode {
+    struct UnrolledNode* nextNode;
+    struct UnrolledNode* previousNode;
+    int count;
+    LSQ_BaseTypeT data[NODE_CAPACITY];
+}   UnrolledNodeT, *UnrolledNodePtrT;
+
+/*    :      .         *
+ *                                                            */
+typedef struct {
+    UnrolledNodePtrT node;
+    int offset;
+}   UnrolledPositionT;
+
+/*  - ,        ,       *
+ * ,           .          *
+ *    cursors;      NULL                                    */
+typedef struct UnrolledCursor {
+    UnrolledPositionT position;
+    struct UnrolledCursor* nextCursor;
+    struct UnrolledCursor* previousCursor;
+}   UnrolledCursorT, *UnrolledCursorPtrT;
+
+typedef struct UnrolledList {
+    LSQ_IntegerIndexT size;
+    UnrolledNodeT beforeFirst, pastRear;
+    UnrolledCursorT cursors;
+    NodePoolPtrT pool;
+}   UnrolledListT, *UnrolledListPtrT;
+
+/* ,     */
+extern UnrolledListPtrT CreateUnrolledList(void);
+/* ,   .    */
+extern void DestroyUnrolledList(UnrolledListPtrT list);
+
+/* ,    .       ,   *
+ *                                                                               */
+extern void AttachUnrolledCursor(UnrolledListPtrT list, UnrolledCursorPtrT cursor);
+/* ,    ,    */
+extern void DetachUnrolledCursor(UnrolledCursorPtrT cursor);
+
+/* ,      */
+static inline LSQ_IntegerIndexT GetUnrolledSize(UnrolledListPtrT list) {
+    return list->size;
+}
+
+/* ,            */
+static inline UnrolledPositionT GetUnrolledBeforeFirst(UnrolledListPtrT list) {
+    UnrolledPositionT position = { &list->beforeFirst, 0 };
+    return position;
+}
+
+static inline UnrolledPositionT GetUnrolledPastRear(UnrolledListPtrT list) {
+    UnrolledPositionT position = { &list->pastRear, 0 };
+    return position;
+}
+
+/* , ,            */
+static inline int IsUnrolledBeforeFirst(UnrolledListPtrT list, UnrolledPositionT position) {
+    return position.node == &list->beforeFirst;
+}
+
+static inline int IsUnrolledPastRear(UnrolledListPtrT list, UnrolledPositionT position) {
+    return position.node == &list->pastRear;
+}
+
+/* ,        */
+static inline LSQ_BaseTypeT* GetUnrolledElement(UnrolledPositionT position) {
+    if(position.offset >= position.node->count) return NULL;
+    return &position.node->data[position.offset];
+}
+
+/* ,       .       */
+extern void ShiftUnrolledPosition(UnrolledPositionT* position, LSQ_IntegerIndexT shift);
+
+/* ,     .       , *
+ *    -   .  0                                 */
+extern int InsertUnrolledElement(UnrolledListPtrT list, UnrolledPositionT* position, LSQ_BaseTypeT element);
+/* ,     .     ,    *
+ * ,   ,    -                                  */
+extern void DeleteUnrolledElement(UnrolledListPtrT list, UnrolledPositionT* position);
+
+#endif
@@ -4,8 +4,13 @@
 
 #include <stdlib.h>
 
+/*          LSQ_BASE_TYPE (  int) */
+#ifndef LSQ_BASE_TYPE
+#define LSQ_BASE_TYPE int
+#endif
+
 /*      */
-typedef int LSQ_BaseTypeT;
+typedef LSQ_BASE_TYPE LSQ_BaseTypeT;
 
 /*   */
 typedef void* LSQ_HandleT;
@@ -19,6 +24,21 @@ typedef void* LSQ_IteratorT;
 /*     */
 typedef int LSQ_IntegerIndexT;
 
+/*       LSQ_KEY_TYPE (  LSQ_IntegerIndexT).    *
+ * LSQ_KEY_LESS,  LSQ_KEY_INVALID   ,    .              */
+#ifndef LSQ_KEY_TYPE
+#define LSQ_KEY_TYPE LSQ_IntegerIndexT
+#endif
+#ifndef LSQ_KEY_LESS
+#define LSQ_KEY_LESS(a, b) ((a) < (b))
+#endif
+#ifndef LSQ_KEY_INVALID
+#define LSQ_KEY_INVALID -1
+#endif
+
+/*    */
+typedef LSQ_KEY_TYPE LSQ_KeyT;
+
 /* ,   .     */
 extern LSQ_HandleT LSQ_CreateSequence(void);
 /* ,     .     */
@@ -37,12 +57,12 @@ extern int LSQ_IsIteratorBeforeFirst(LSQ_IteratorT iterator);
 /*   .     ,      */
 extern LSQ_BaseTypeT* LSQ_DereferenceIterator(LSQ_IteratorT iterator);
 /*   .     ,      */
-extern LSQ_IntegerIndexT LSQ_GetIteratorKey(LSQ_IteratorT iterator);
+extern LSQ_KeyT LSQ_GetIteratorKey(LSQ_IteratorT iterator);
 
 /*            */
 /* ,  ,      .       *
  *   ,     PastRear.                                       */
-extern LSQ_IteratorT LSQ_GetElementByIndex(LSQ_HandleT handle, LSQ_IntegerIndexT index);
+extern LSQ_IteratorT LSQ_GetElementByIndex(LSQ_HandleT handle, LSQ_KeyT key);
 /* ,  ,      */
 extern LSQ_IteratorT LSQ_GetFrontElement(LSQ_HandleT handle);
 /* ,  ,    ,      */
@@ -64,13 +84,13 @@ extern void LSQ_SetPosition(LSQ_IteratorT iterator, LSQ_IntegerIndexT pos);
 
 /* ,    -  .      ,  *
  *    .                                                                  */
-extern void LSQ_InsertElement(LSQ_HandleT handle, LSQ_IntegerIndexT key, LSQ_BaseTypeT value);
+extern void LSQ_InsertElement(LSQ_HandleT handle, LSQ_KeyT key, LSQ_BaseTypeT value);
 
 /* ,     */
 extern void LSQ_DeleteFrontElement(LSQ_HandleT handle);
 /* ,     */
 extern void LSQ_DeleteRearElement(LSQ_HandleT handle);
 /* ,   ,   . */
-extern void LSQ_DeleteElement(LSQ_HandleT handle, LSQ_IntegerIndexT key);
+extern void LSQ_DeleteElement(LSQ_HandleT handle, LSQ_KeyT key);
 
 #endif
@@ -1,5 +1,7 @@
 #include "linear_sequence_assoc.h"
 
+#define KEY_EQUAL(a, b) (!LSQ_KEY_LESS(a, b) && !LSQ_KEY_LESS(b, a))
+
 typedef enum {
     ITERATOR_DEREFERENCABLE,
     ITERATOR_BEFORE_FIRST,
@@ -10,7 +12,7 @@ typedef struct Node {
     struct Node *parentNode;
     struct Node *leftNode;
     struct Node *rightNode;
-    LSQ_IntegerIndexT key;
+    LSQ_KeyT key;
     LSQ_BaseTypeT value;
     int height;
 }   NodeT, *NodePtrT;
@@ -28,11 +30,11 @@ typedef struct {
 
 static IteratorPtrT CreateIterator(LSQ_HandleT handle, NodePtrT node, IteratorTypeT type);
 
-static NodePtrT GetNodeByIndex(NodePtrT node, LSQ_IntegerIndexT key);
+static NodePtrT GetNodeByIndex(NodePtrT node, LSQ_KeyT key);
 static NodePtrT GetLeftLeaf(NodePtrT node);
 static NodePtrT GetRightLeaf(NodePtrT node);
-static NodePtrT CreateNode(LSQ_IntegerIndexT key, LSQ_BaseTypeT value, NodePtrT parent);
-static NodePtrT GoToLeaf(NodePtrT node, LSQ_IntegerIndexT key);
+static NodePtrT CreateNode(LSQ_KeyT key, LSQ_BaseTypeT value, NodePtrT parent);
+static NodePtrT GoToLeaf(NodePtrT node, LSQ_KeyT key);
 
 static void ReplaceNode(TreePtrT tree, NodePtrT node, NodePtrT new_node);
 static void DeleteNode(NodePtrT node);
@@ -54,12 +56,16 @@ static IteratorPtrT CreateIterator(LSQ_HandleT handle, NodePtrT node, IteratorTy
     return iterator;
 }
 
-static NodePtrT GetNodeByIndex(NodePtrT node, LSQ_IntegerIndexT key){
-    while(node != NULL && node->key != key)
-        if(node->key < key)
+/*         ,     */
+static NodePtrT GetNodeByIndex(NodePtrT node, LSQ_KeyT key){
+    while(node != NULL)
+        if(LSQ_KEY_LESS(node->key, key))
             node = node->rightNode;
         else
-            node = node->leftNode;
+            if(LSQ_KEY_LESS(key, node->key))
+                node = node->leftNode;
+            else
+                return node;
     return node;
 }
 
@@ -75,7 +81,7 @@ static NodePtrT GetRightLeaf(NodePtrT node) {
     return node;
 }
 
-static NodePtrT CreateNode(LSQ_IntegerIndexT key, LSQ_BaseTypeT value, NodePtrT parentNode){
+static NodePtrT CreateNode(LSQ_KeyT key, LSQ_BaseTypeT value, NodePtrT parentNode){
     NodePtrT node = (NodePtrT)malloc(sizeof(NodeT));
     if(node == NULL) return NULL;
     node->key = key;
@@ -83,25 +89,24 @@ static NodePtrT CreateNode(LSQ_IntegerIndexT key, LSQ_BaseTypeT value, NodePtrT
     node->parentNode = parentNode;
     node->leftNode = NULL;
     node->rightNode = NULL;
+    node->height = 1;
     return node;
 }
 
-static NodePtrT GoToLeaf(NodePtrT node, LSQ_IntegerIndexT key) {
-    if(key < node->key) {
-        if(node->leftNode != NULL)
-            return GoToLeaf(node->leftNode, key);
-        else
-            return node;
-    }
-    else 
-        if(key > node->key) {
-            if(node->rightNode != NULL) 
-                return GoToLeaf(node->rightNode, key);
+static NodePtrT GoToLeaf(NodePtrT node, LSQ_KeyT key) {
+    NodePtrT next = node;
+    
+    while(next != NULL) {
+        node = next;
+        if(LSQ_KEY_LESS(key, node->key))
+            next = node->leftNode;
+        else 
+            if(LSQ_KEY_LESS(node->key, key))
+                next = node->rightNode;
             else
                 return node;
-        }
-        else
-            return node;
+    }
+    return node;
 }
 
 static void ReplaceNode(TreePtrT tree, NodePtrT node, NodePtrT newNode){
@@ -227,14 +232,14 @@ extern LSQ_BaseTypeT* LSQ_DereferenceIterator(LSQ_IteratorT iterator) {
     return &(((IteratorPtrT)iterator)->node->value);
 }
 
-extern LSQ_IntegerIndexT LSQ_GetIteratorKey(LSQ_IteratorT iterator) {
-    if(iterator == NULL || ((IteratorPtrT)iterator)->node == NULL) return -1;
+extern LSQ_KeyT LSQ_GetIteratorKey(LSQ_IteratorT iterator) {
+    if(iterator == NULL || ((IteratorPtrT)iterator)->node == NULL) return LSQ_KEY_INVALID;
     return ((IteratorPtrT)iterator)->node->key;
 }
 
-extern LSQ_IteratorT LSQ_GetElementByIndex(LSQ_HandleT handle, LSQ_IntegerIndexT index) {
+extern LSQ_IteratorT LSQ_GetElementByIndex(LSQ_HandleT handle, LSQ_KeyT key) {
     if(handle == LSQ_HandleInvalid) return NULL;
-    NodePtrT node = GetNodeByIndex(((TreePtrT)handle)->root, index);
+    NodePtrT node = GetNodeByIndex(((TreePtrT)handle)->root, key);
     if(node == NULL)
         return LSQ_GetPastRearElement(handle);
     return CreateIterator(handle, node, ITERATOR_DEREFERENCABLE);
@@ -336,7 +341,7 @@ extern void LSQ_SetPosition(LSQ_IteratorT iterator, LSQ_IntegerIndexT pos) {
     LSQ_ShiftPosition(iterator, pos + 1);
 }
 
-extern void LSQ_InsertElement(LSQ_HandleT handle, LSQ_IntegerIndexT key, LSQ_BaseTypeT value) {
+extern void LSQ_InsertElement(LSQ_HandleT handle, LSQ_KeyT key, LSQ_BaseTypeT value) {
     if(handle == LSQ_HandleInvalid) return;
     TreePtrT tree = (TreePtrT)handle;
     
@@ -347,7 +352,7 @@ extern void LSQ_InsertElement(LSQ_HandleT handle, LSQ_IntegerIndexT key, LSQ_Bas
     }
     
     NodePtrT parent = GoToLeaf(tree->root, key);
-    if(parent->key == key) { 
+    if(KEY_EQUAL(parent->key, key)) { 
         parent->value = value;
         return;
     }
@@ -356,7 +361,7 @@ extern void LSQ_InsertElement(LSQ_HandleT handle, LSQ_IntegerIndexT key, LSQ_Bas
     if(node == NULL) return;
     
     tree->size++;
-    if(key < parent->key)
+    if(LSQ_KEY_LESS(key, parent->key))
         parent->leftNode = node;
     else
         parent->rightNode = node;
@@ -379,7 +384,7 @@ extern void LSQ_DeleteRearElement(LSQ_HandleT handle) {
     LSQ_DestroyIterator(iterator);    
 }
 
-extern void LSQ_DeleteElement(LSQ_HandleT handle, LSQ_IntegerIndexT key) {
+extern void LSQ_DeleteElement(LSQ_HandleT handle, LSQ_KeyT key) {
     TreePtrT tree = (TreePtrT)handle;
     if(handle == LSQ_HandleInvalid || tree->root == NULL) return;
     
@@ -388,7 +393,7 @@ extern void LSQ_DeleteElement(LSQ_HandleT handle, LSQ_IntegerIndexT key) {
     
     NodePtrT parentNode = node->parentNode;
     NodePtrT leftNode = NULL;
-    int keyValue;
+    LSQ_KeyT keyValue;
     
     if(node->leftNode == NULL && node->rightNode == NULL)
         ReplaceNode(tree, node, NULL);
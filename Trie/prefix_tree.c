@@ -15,6 +15,7 @@ typedef struct Node {
     struct Node *parentNode;
     struct Node *link[LINK_LIMIT];
     char key;
+    int hasValue;
     LSQ_BaseTypeT value;
 }   NodeT, *NodePtrT;
 
@@ -37,7 +38,7 @@ static void DeleteSubtree(const NodePtrT node);
 static void DeleteNode(NodePtrT node);
 
 static NodePtrT GetNodeByKey(const NodePtrT node, const LSQ_KeyT key);
-static NodePtrT CreateNode(const char key, const LSQ_BaseTypeT value, const NodePtrT parent);
+static NodePtrT CreateNode(const char key, const NodePtrT parent);
 static NodePtrT GetChildNodeWithIdenticalKey(const NodePtrT node, const char key);
 static NodePtrT GoToMinimalNode(const NodePtrT node);
 static NodePtrT GoToMaximalNode(const NodePtrT node);
@@ -60,19 +61,19 @@ static NodePtrT GetNodeByKey(const NodePtrT node, const LSQ_KeyT key) {
     int i, size = strlen(key);
     
     for(i = 0; i < size; i++) {
-        n = GetChildNodebYKey(iterator, key[i]);
+        n = GetChildNodeWithIdenticalKey(iterator, key[i]);
         if(n == NULL) return NULL;   
         else iterator = n;  
     }
     return iterator;
 }
-/* ,  .     */
-static NodePtrT CreateNode(const char key, const LSQ_BaseTypeT value, const NodePtrT parentNode){
+/* ,    .     */
+static NodePtrT CreateNode(const char key, const NodePtrT parentNode){
     NodePtrT node = (NodePtrT)malloc(sizeof(NodeT));
 	int i;
 
     if(node == NULL) return NULL;
-    node->value = value;
+    node->hasValue = 0;
     node->key = key;
     node->parentNode = parentNode;
     
@@ -162,18 +163,20 @@ static NodePtrT GetLeftNeighbour(const NodePtrT node) {
 /* ,  ,        */
 static void DeleteNode(NodePtrT node) {
     NodePtrT parent = node->parentNode;
-	int i, index;
+	int i;
 
     if(parent == NULL) return; 
 
-    for(i = 0; i < LINK_LIMIT; i++) 
-        if(parent->link[i] != NULL && parent->link[i]->key == node->key) 
-            index = i; 
+    for(i = 0; i < LINK_LIMIT; i++) {
+        if(parent->link[i] == node) {
+            parent->link[i] = NULL;
+            break;
+        }
+    }
 
-    parent->link[index] = NULL;
 	free(node);
     node = NULL;
-    if(!IsHaveChild(parent) && parent->value == NULL) DeleteNode(parent);
+    if(!IsHaveChild(parent) && !parent->hasValue) DeleteNode(parent);
 }
 /* ,       .   ,   NULL */
 static NodePtrT GetChildNodeWithIdenticalKey(const NodePtrT node, const char key) {
@@ -234,8 +237,8 @@ extern char* LSQ_GetIteratorKey(LSQ_IteratorT iterator) {
 	revKey = calloc(KEY_SIZE, sizeof(char));
 
 	for(i = 0; i < KEY_SIZE; i++) {
-		key[i] = NULL;
-		revKey[i] = NULL;
+		key[i] = '\0';
+		revKey[i] = '\0';
 	}
 
 	node = ((IteratorPtrT)iterator)->node;
@@ -260,7 +263,7 @@ extern LSQ_IteratorT LSQ_GetElementByIndex(LSQ_HandleT handle, LSQ_KeyT key) {
 	NodePtrT node = GetNodeByKey(((TreePtrT)handle)->root, key);
 
     if(handle == LSQ_HandleInvalid) return NULL;
-    if(node == NULL) return LSQ_GetPastRearElement(handle);
+    if(node == NULL || !node->hasValue) return LSQ_GetPastRearElement(handle);
     return CreateIterator(handle, node, ITERATOR_DEREFERENCABLE);
 }
 
@@ -364,7 +367,7 @@ extern void LSQ_InsertElement(LSQ_HandleT handle, LSQ_KeyT key, LSQ_BaseTypeT va
 	if(handle == LSQ_HandleInvalid) return;
 
     if(node == NULL) { 
-        node = CreateNode("", NULL, NULL);  
+        node = CreateNode('\0', NULL);  
         trie->root = node;
     }
     
@@ -373,7 +376,7 @@ extern void LSQ_InsertElement(LSQ_HandleT handle, LSQ_KeyT key, LSQ_BaseTypeT va
         if(n == NULL) {
             for(j = 0; j < LINK_LIMIT; j++) 
                 if(node->link[j] == NULL) {
-                    node->link[j] = CreateNode(key[i], NULL, node);   
+                    node->link[j] = CreateNode(key[i], node);   
                     node = node->link[j]; 
                     break;    
                 }
@@ -381,7 +384,8 @@ extern void LSQ_InsertElement(LSQ_HandleT handle, LSQ_KeyT key, LSQ_BaseTypeT va
         else node = n; 
     }
     node->value = value;
-    trie->size++;
+    if(!node->hasValue) trie->size++;
+    node->hasValue = 1;
 }
 
 extern void LSQ_DeleteFrontElement(LSQ_HandleT handle) {
@@ -420,11 +424,11 @@ extern void LSQ_DeleteElement(LSQ_HandleT handle, LSQ_KeyT key) {
 	if(handle == LSQ_HandleInvalid) return;
 	trie = (TreePtrT)handle;
 	node = GetNodeByKey(trie->root, key);
-    if(node == NULL) return;
+    if(node == NULL || !node->hasValue) return;
 
 	if(!IsHaveChild(node)) 
 		DeleteNode(node); 
     else
-        node->value = NULL;
+        node->hasValue = 0;
     trie->size--;
 }
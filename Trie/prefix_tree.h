@@ -4,8 +4,13 @@
 
 #include <stdlib.h>
 
+/*          LSQ_BASE_TYPE (  int) */
+#ifndef LSQ_BASE_TYPE
+#define LSQ_BASE_TYPE int
+#endif
+
 /*      */
-typedef int LSQ_BaseTypeT;
+typedef LSQ_BASE_TYPE LSQ_BaseTypeT;
 
 /*    */
 typedef char* LSQ_KeyT;
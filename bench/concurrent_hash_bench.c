@@ -0,0 +1,132 @@
+/*  LSQ_ConcurrentHashT        1, 2, 4  ..    *
+ * N,  N -     ,    5%  (  )   50%   *
+ * .     .                                                             *
+ * : gcc -std=gnu11 -O2 -pthread -IHash bench/concurrent_hash_bench.c Hash/concurrent_hash.c             *
+ *         Hash/hash.c Hash/key_hash.c Hash/swiss_table.c Hash/bloom_filter.c -o concurrent_hash_bench         */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "concurrent_hash.h"
+
+#define KEY_COUNT 100000
+#define OPERATION_COUNT 1000000
+
+static LSQ_ConcurrentHashT concurrentTable;
+static LSQ_HandleT lockedTable;
+static pthread_mutex_t tableMutex = PTHREAD_MUTEX_INITIALIZER;
+static int writePercent, useLock;
+
+static void* CloneKey(void* key) {
+    size_t size = strlen((char*)key) + 1;
+    void* copy = malloc(size);
+    
+    if(copy != NULL) memcpy(copy, key, size);
+    return copy;
+}
+
+static size_t GetKeySize(void* key) {
+    return strlen((char*)key);
+}
+
+static int CompareKeys(void* first, void* second) {
+    return strcmp((char*)first, (char*)second);
+}
+
+static void* CloneValue(void* value) {
+    long* copy = (long*)malloc(sizeof(long));
+    
+    if(copy != NULL) *copy = *(long*)value;
+    return copy;
+}
+
+static double GetTime(void) {
+    struct timespec time;
+    
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+/*   - ,  - ,   -  */
+static void* Work(void* argument) {
+    unsigned int seed = (unsigned int)(size_t)argument * 7919 + 1;
+    LSQ_IteratorT iterator;
+    char key[32];
+    long value;
+    int i, operation;
+    
+    for(i = 0; i < OPERATION_COUNT; i++) {
+        seed = seed * 1103515245 + 12345;
+        sprintf(key, "k%u", (seed >> 8) % KEY_COUNT);
+        operation = (int)((seed >> 4) % 100);
+        value = i;
+        if(!useLock) {
+            if(operation < writePercent / 2) LSQ_ConcurrentInsertElement(concurrentTable, key, &value);
+            else if(operation < writePercent) LSQ_ConcurrentDeleteElement(concurrentTable, key);
+            else free(LSQ_ConcurrentGetElement(concurrentTable, key));
+            continue;
+        }
+        pthread_mutex_lock(&tableMutex);
+        if(operation < writePercent / 2) LSQ_InsertElement(lockedTable, key, &value);
+        else if(operation < writePercent) LSQ_DeleteElement(lockedTable, key);
+        else {
+            iterator = LSQ_GetElementByIndex(lockedTable, key);
+            if(LSQ_IsIteratorDereferencable(iterator)) free(CloneValue(LSQ_DereferenceIterator(iterator)));
+            LSQ_DestroyIterator(iterator);
+        }
+        pthread_mutex_unlock(&tableMutex);
+    }
+    return NULL;
+}
+
+/* ,    : ,    maximal */
+static int GetNextThreadCount(int threadCount, int maximal) {
+    return threadCount * 2 < maximal ? threadCount * 2 : maximal;
+}
+
+static double Run(int threadCount) {
+    pthread_t* threads = (pthread_t*)malloc(sizeof(pthread_t) * threadCount);
+    char key[32];
+    long value = 0;
+    double start;
+    int i;
+    
+    if(threads == NULL) return 0.0;
+    concurrentTable = LSQ_CreateConcurrentHash(CloneKey, GetKeySize, CompareKeys, CloneValue);
+    lockedTable = LSQ_CreateSequence(CloneKey, GetKeySize, CompareKeys, CloneValue);
+    for(i = 0; i < KEY_COUNT / 2; i++) {
+        sprintf(key, "k%d", i);
+        if(useLock) LSQ_InsertElement(lockedTable, key, &value);
+        else LSQ_ConcurrentInsertElement(concurrentTable, key, &value);
+    }
+    start = GetTime();
+    for(i = 0; i < threadCount; i++)
+        pthread_create(&threads[i], NULL, Work, (void*)(size_t)i);
+    for(i = 0; i < threadCount; i++)
+        pthread_join(threads[i], NULL);
+    start = GetTime() - start;
+    LSQ_DestroyConcurrentHash(concurrentTable);
+    LSQ_DestroySequence(lockedTable);
+    free(threads);
+    return threadCount * (double)OPERATION_COUNT / start / 1e6;
+}
+
+int main(int argc, char* argv[]) {
+    static const int writePercents[] = {5, 50};
+    int maximalThreadCount = argc > 1 ? atoi(argv[1]) : (int)sysconf(_SC_NPROCESSORS_ONLN), i, threadCount;
+    
+    if(maximalThreadCount < 1) maximalThreadCount = 1;
+    for(i = 0; i < 2; i++) {
+        writePercent = writePercents[i];
+        for(threadCount = 1; ; threadCount = GetNextThreadCount(threadCount, maximalThreadCount)) {
+            useLock = 0;
+            printf("writes %2d%%, threads %d: concurrent %6.2f Mops/s", writePercent, threadCount, Run(threadCount));
+            useLock = 1;
+            printf(", one mutex %6.2f Mops/s\n", Run(threadCount));
+            if(threadCount == maximalThreadCount) break;
+        }
+    }
+    return 0;
+}
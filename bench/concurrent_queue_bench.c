@@ -0,0 +1,134 @@
+/*  LSQ_ConcurrentQueueT      (LSQ_InsertRearElement  LSQ_DeleteFrontElement) *
+ *  1+1, 2+2, 4+4  ..      N+N,  N -            *
+ * .      .                                                         *
+ * : gcc -std=gnu11 -O2 -pthread -IList bench/concurrent_queue_bench.c List/concurrent_queue.c List/list.c      *
+ *         List/node_pool.c List/unrolled_list.c -o concurrent_queue_bench                                            */
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#include "concurrent_queue.h"
+
+#define ELEMENT_COUNT 2000000
+
+static LSQ_ConcurrentQueueT concurrentQueue;
+static LSQ_HandleT lockedList;
+static pthread_mutex_t listMutex = PTHREAD_MUTEX_INITIALIZER;
+static int threadCount, useLock;
+
+static double GetTime(void) {
+    struct timespec time;
+    
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+/*    ELEMENT_COUNT / threadCount  */
+static void* Produce(void* argument) {
+    int count = ELEMENT_COUNT / threadCount, i;
+    
+    (void)argument;
+    for(i = 1; i <= count; i++)
+        if(useLock) {
+            pthread_mutex_lock(&listMutex);
+            LSQ_InsertRearElement(lockedList, i);
+            pthread_mutex_unlock(&listMutex);
+        }
+        else
+            while(!LSQ_ConcurrentPushRear(concurrentQueue, i));
+    return NULL;
+}
+
+/*     ,    ,    */
+static void* Consume(void* argument) {
+    int count = ELEMENT_COUNT / threadCount, taken = 0, found;
+    long* sum = (long*)argument;
+    LSQ_IteratorT iterator;
+    LSQ_BaseTypeT element;
+    
+    while(taken < count) {
+        if(useLock) {
+            pthread_mutex_lock(&listMutex);
+            found = LSQ_GetSize(lockedList) > 0;
+            if(found) {
+                iterator = LSQ_GetFrontElement(lockedList);
+                element = *LSQ_DereferenceIterator(iterator);
+                LSQ_DestroyIterator(iterator);
+                LSQ_DeleteFrontElement(lockedList);
+            }
+            pthread_mutex_unlock(&listMutex);
+        }
+        else
+            found = LSQ_ConcurrentPopFront(concurrentQueue, &element);
+        if(found) {
+            *sum += element;
+            taken++;
+        }
+        else
+            sched_yield();
+    }
+    return NULL;
+}
+
+/* ,    : ,    maximal */
+static int GetNextThreadCount(int threads, int maximal) {
+    return threads * 2 < maximal ? threads * 2 : maximal;
+}
+
+static double Run(int threads, int locked) {
+    pthread_t* producers = (pthread_t*)malloc(sizeof(pthread_t) * threads);
+    pthread_t* consumers = (pthread_t*)malloc(sizeof(pthread_t) * threads);
+    long* consumedSums = (long*)malloc(sizeof(long) * threads);
+    long count, expected, total = 0;
+    double start;
+    int i;
+    
+    if(producers == NULL || consumers == NULL || consumedSums == NULL) {
+        free(producers);
+        free(consumers);
+        free(consumedSums);
+        return 0.0;
+    }
+    threadCount = threads;
+    useLock = locked;
+    start = GetTime();
+    for(i = 0; i < threads; i++) {
+        consumedSums[i] = 0;
+        pthread_create(&consumers[i], NULL, Consume, &consumedSums[i]);
+        pthread_create(&producers[i], NULL, Produce, NULL);
+    }
+    for(i = 0; i < threads; i++) {
+        pthread_join(producers[i], NULL);
+        pthread_join(consumers[i], NULL);
+        total += consumedSums[i];
+    }
+    start = GetTime() - start;
+    count = ELEMENT_COUNT / threads;
+    expected = threads * (count * (count + 1) / 2);
+    if(total != expected)
+        printf("%s: FAILED\n", locked ? "locked list" : "concurrent queue");
+    free(producers);
+    free(consumers);
+    free(consumedSums);
+    return threads * count / start * 1e-6;
+}
+
+int main(int argc, char* argv[]) {
+    int maximalThreadCount = argc > 1 ? atoi(argv[1]) : (int)sysconf(_SC_NPROCESSORS_ONLN), threads;
+    
+    if(maximalThreadCount < 1) maximalThreadCount = 1;
+    concurrentQueue = LSQ_CreateConcurrentQueue();
+    lockedList = LSQ_CreateSequence();
+    if(concurrentQueue == LSQ_ConcurrentQueueInvalid || lockedList == LSQ_HandleInvalid)
+        return 1;
+    for(threads = 1; ; threads = GetNextThreadCount(threads, maximalThreadCount)) {
+        printf("%d+%d threads: concurrent queue %6.2f Mops/s", threads, threads, Run(threads, 0));
+        printf("  locked list %6.2f Mops/s\n", Run(threads, 1));
+        if(threads == maximalThreadCount) break;
+    }
+    LSQ_DestroyConcurrentQueue(concurrentQueue);
+    LSQ_DestroySequence(lockedList);
+    return 0;
+}
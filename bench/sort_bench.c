@@ -0,0 +1,91 @@
+/*  LSQ_Sort    :    ,  qsort *
+ *   .    - 10 ,     .  *
+ * : gcc -std=gnu99 -O2 -pthread -IDynArray bench/sort_bench.c DynArray/dynarray.c           *
+ *         DynArray/sort.c DynArray/scan_kernels.c DynArray/tiered_vector.c -o sort_bench          */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linear_sequence.h"
+
+#define DEFAULT_SIZE 10000000
+
+static double GetTime(void) {
+    struct timespec time;
+    
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+static int CompareElements(const void* first, const void* second) {
+    LSQ_BaseTypeT a = *(const LSQ_BaseTypeT*)first, b = *(const LSQ_BaseTypeT*)second;
+    
+    return (a > b) - (a < b);
+}
+
+/* ,          */
+static LSQ_HandleT CreateRandomSequence(LSQ_IntegerIndexT size) {
+    LSQ_HandleT handle = LSQ_CreateSequence();
+    unsigned int seed = 1;
+    LSQ_IntegerIndexT i;
+    
+    for(i = 0; i < size; i++) {
+        seed = seed * 1103515245 + 12345;
+        LSQ_InsertRearElement(handle, (LSQ_BaseTypeT)(seed ^ (seed >> 16)));
+    }
+    return handle;
+}
+
+/* , ,       */
+static int IsSorted(LSQ_HandleT handle) {
+    LSQ_IteratorT iterator = LSQ_GetFrontElement(handle);
+    LSQ_BaseTypeT previous;
+    int sorted = 1;
+    
+    if(LSQ_IsIteratorDereferencable(iterator)) {
+        previous = *LSQ_DereferenceIterator(iterator);
+        for(LSQ_AdvanceOneElement(iterator); sorted && LSQ_IsIteratorDereferencable(iterator); LSQ_AdvanceOneElement(iterator)) {
+            sorted = previous <= *LSQ_DereferenceIterator(iterator);
+            previous = *LSQ_DereferenceIterator(iterator);
+        }
+    }
+    LSQ_DestroyIterator(iterator);
+    return sorted;
+}
+
+int main(int argc, char* argv[]) {
+    LSQ_IntegerIndexT size = argc > 1 ? atoi(argv[1]) : DEFAULT_SIZE, i;
+    LSQ_BaseTypeT* buffer;
+    LSQ_IteratorT iterator;
+    LSQ_HandleT handle;
+    double start, sortTime, copyTime;
+    
+    buffer = (LSQ_BaseTypeT*)malloc(sizeof(LSQ_BaseTypeT) * size);
+    if(size <= 0 || buffer == NULL)
+        return 1;
+    
+    handle = CreateRandomSequence(size);
+    start = GetTime();
+    LSQ_Sort(handle);
+    sortTime = GetTime() - start;
+    if(!IsSorted(handle))
+        printf("LSQ_Sort: FAILED\n");
+    LSQ_DestroySequence(handle);
+    
+    handle = CreateRandomSequence(size);
+    start = GetTime();
+    iterator = LSQ_GetFrontElement(handle);
+    for(i = 0; i < size; i++, LSQ_AdvanceOneElement(iterator))
+        buffer[i] = *LSQ_DereferenceIterator(iterator);
+    LSQ_DestroyIterator(iterator);
+    qsort(buffer, size, sizeof(LSQ_BaseTypeT), CompareElements);
+    while(LSQ_GetSize(handle) > 0)
+        LSQ_DeleteRearElement(handle);
+    for(i = 0; i < size; i++)
+        LSQ_InsertRearElement(handle, buffer[i]);
+    copyTime = GetTime() - start;
+    LSQ_DestroySequence(handle);
+    
+    printf("n=%d  LSQ_Sort %.2f s  iterators + qsort %.2f s\n", size, sortTime, copyTime);
+    free(buffer);
+    return 0;
+}
@@ -0,0 +1,73 @@
+/*      DynArray:        *
+ *        10 , 100   10  .                    *
+ * : gcc -std=gnu99 -O2 -pthread -IDynArray bench/tiered_vector_bench.c DynArray/dynarray.c             *
+ *         DynArray/sort.c DynArray/scan_kernels.c DynArray/tiered_vector.c -o tiered_vector_bench            */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linear_sequence.h"
+
+#define OPERATION_COUNT 20000
+#define READ_COUNT 1000000
+
+static double GetTime(void) {
+    struct timespec time;
+    
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+/* ,              */
+static double MeasureMiddleOperations(LSQ_HandleT handle, LSQ_IntegerIndexT size) {
+    unsigned int seed = 1;
+    LSQ_IteratorT iterator;
+    double start = GetTime();
+    int i;
+    
+    for(i = 0; i < OPERATION_COUNT; i++) {
+        seed = seed * 1103515245 + 12345;
+        iterator = LSQ_GetElementByIndex(handle, (LSQ_IntegerIndexT)((seed >> 1) % size));
+        LSQ_InsertElementBeforeGiven(iterator, i);
+        LSQ_DeleteGivenElement(iterator);
+        LSQ_DestroyIterator(iterator);
+    }
+    return (GetTime() - start) * 1e9 / (2 * OPERATION_COUNT);
+}
+
+/* ,           */
+static double MeasureIndexedReads(LSQ_HandleT handle, LSQ_IntegerIndexT size, long* sum) {
+    unsigned int seed = 2;
+    LSQ_IteratorT iterator = LSQ_GetFrontElement(handle);
+    double start = GetTime();
+    int i;
+    
+    for(i = 0; i < READ_COUNT; i++) {
+        seed = seed * 1103515245 + 12345;
+        LSQ_SetPosition(iterator, (LSQ_IntegerIndexT)((seed >> 1) % size));
+        *sum += *LSQ_DereferenceIterator(iterator);
+    }
+    LSQ_DestroyIterator(iterator);
+    return (GetTime() - start) * 1e9 / READ_COUNT;
+}
+
+int main(void) {
+    LSQ_IntegerIndexT sizes[] = {10000, 100000, 10000000}, i;
+    LSQ_SequenceLayoutT layouts[] = {LSQ_LAYOUT_FLAT, LSQ_LAYOUT_TIERED};
+    const char* names[] = {"flat", "tiered"};
+    LSQ_HandleT handle;
+    double middle, read;
+    long sum = 0;
+    int s, l;
+    
+    for(s = 0; s < 3; s++)
+        for(l = 0; l < 2; l++) {
+            handle = LSQ_CreateSequenceWithLayout(layouts[l]);
+            for(i = 0; i < sizes[s]; i++)
+                LSQ_InsertRearElement(handle, i);
+            middle = MeasureMiddleOperations(handle, sizes[s]);
+            read = MeasureIndexedReads(handle, sizes[s], &sum);
+            printf("n=%-9d %-6s middle insert/delete %8.0f ns  indexed read %5.1f ns\n", sizes[s], names[l], middle, read);
+            LSQ_DestroySequence(handle);
+        }
+    return sum == 0;
+}
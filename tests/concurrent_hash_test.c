@@ -0,0 +1,98 @@
+/*  LSQ_ConcurrentGetElement     :     *
+ *  ,        .                                        *
+ * : gcc -std=gnu11 -O2 -pthread -IHash tests/concurrent_hash_test.c Hash/concurrent_hash.c           *
+ *         Hash/key_hash.c -o concurrent_hash_test                                                          */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "concurrent_hash.h"
+
+#define THREAD_COUNT 8
+#define KEY_COUNT 3000
+#define OPERATION_COUNT 500000
+
+static LSQ_ConcurrentHashT table;
+static volatile int failed;
+
+static void* CloneKey(void* key) {
+    size_t size = strlen((char*)key) + 1;
+    void* copy = malloc(size);
+    
+    if(copy != NULL) memcpy(copy, key, size);
+    return copy;
+}
+
+static size_t GetKeySize(void* key) {
+    return strlen((char*)key);
+}
+
+static int CompareKeys(void* first, void* second) {
+    return strcmp((char*)first, (char*)second);
+}
+
+static void* CloneValue(void* value) {
+    long* copy = (long*)malloc(sizeof(long));
+    
+    if(copy != NULL) *copy = *(long*)value;
+    return copy;
+}
+
+/*   k  k * KEY_COUNT + i,        */
+static void* Work(void* argument) {
+    unsigned int seed = (unsigned int)(size_t)argument * 7919 + 1;
+    char key[32];
+    long value, *found;
+    int i, k, operation;
+    
+    for(i = 0; i < OPERATION_COUNT && !failed; i++) {
+        seed = seed * 1103515245 + 12345;
+        k = (int)((seed >> 8) % KEY_COUNT);
+        operation = (int)((seed >> 4) % 3);
+        sprintf(key, "k%d", k);
+        if(operation == 0) {
+            value = (long)k * KEY_COUNT + i % KEY_COUNT;
+            LSQ_ConcurrentInsertElement(table, key, &value);
+        }
+        else if(operation == 1) {
+            LSQ_ConcurrentDeleteElement(table, key);
+        }
+        else {
+            found = (long*)LSQ_ConcurrentGetElement(table, key);
+            if(found != NULL && *found / KEY_COUNT != k) {
+                printf("BAD key %d got %ld\n", k, *found / KEY_COUNT);
+                failed = 1;
+            }
+            free(found);
+        }
+    }
+    return NULL;
+}
+
+int main(void) {
+    pthread_t threads[THREAD_COUNT];
+    char key[32];
+    long* found;
+    int i, count = 0;
+    
+    table = LSQ_CreateConcurrentHash(CloneKey, GetKeySize, CompareKeys, CloneValue);
+    if(table == LSQ_ConcurrentHashInvalid) return 1;
+    for(i = 0; i < THREAD_COUNT; i++)
+        pthread_create(&threads[i], NULL, Work, (void*)(size_t)i);
+    for(i = 0; i < THREAD_COUNT; i++)
+        pthread_join(threads[i], NULL);
+    
+    for(i = 0; i < KEY_COUNT; i++) {
+        sprintf(key, "k%d", i);
+        found = (long*)LSQ_ConcurrentGetElement(table, key);
+        if(found != NULL) count++;
+        free(found);
+    }
+    if(count != LSQ_ConcurrentGetSize(table)) {
+        printf("BAD size %d, found %d\n", LSQ_ConcurrentGetSize(table), count);
+        failed = 1;
+    }
+    LSQ_DestroyConcurrentHash(table);
+    puts(failed ? "FAILED" : "OK");
+    return failed;
+}